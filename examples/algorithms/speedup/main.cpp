@@ -0,0 +1,184 @@
+/*
+    Copyright (c) 2025 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/* Example program that compares the algorithms of the tbb::algorithms library
+   with their serial counterparts from the C++ standard library. */
+
+#define TBB_PREVIEW_ALGORITHMS 1
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "oneapi/tbb/algorithms.h"
+#include "oneapi/tbb/global_control.h"
+#include "oneapi/tbb/tick_count.h"
+
+#include "common/utility/utility.hpp"
+#include "common/utility/get_default_num_threads.hpp"
+
+static std::size_t num_elements = 1000000;
+static unsigned repetitions = 5;
+static bool silent = false;
+
+//! Parse the command line.
+static void parse_command_line(int argc, char* argv[], utility::thread_number_range& threads) {
+    utility::parse_cli_arguments(
+        argc,
+        argv,
+        utility::cli_argument_pack()
+            //"-h" option for displaying help is present implicitly
+            .positional_arg(threads, "n-of-threads", utility::thread_number_range_desc)
+            .positional_arg(num_elements, "n-of-elements", "number of elements in the input sequences")
+            .positional_arg(repetitions, "n-of-repetitions", "number of times each algorithm is run")
+            .arg(silent, "silent", "no output except elapsed time"));
+}
+
+static std::vector<int> input1, input2, sorted1, sorted2;
+static std::vector<int> output;
+
+//! Returns the total time of the repetitions of f in seconds
+template <typename F>
+double measure(F f) {
+    double total = 0;
+    for (unsigned r = 0; r < repetitions; ++r) {
+        oneapi::tbb::tick_count t0 = oneapi::tbb::tick_count::now();
+        f();
+        total += (oneapi::tbb::tick_count::now() - t0).seconds();
+    }
+    return total;
+}
+
+template <typename Serial, typename Parallel>
+void compare(const char* name, Serial serial, Parallel parallel, int threads) {
+    double serial_time = measure(serial);
+    double parallel_time = measure(parallel);
+    if (!silent) {
+        std::cout << std::setw(26) << std::left << name << std::right << " serial " << std::setw(9)
+                  << serial_time << " s, " << threads << " threads " << std::setw(9) << parallel_time
+                  << " s, speedup " << serial_time / parallel_time << "\n";
+    }
+}
+
+static void run_all(int threads) {
+    namespace algo = oneapi::tbb::algorithms;
+    auto is_even = [](int x) {
+        return x % 2 == 0;
+    };
+    auto square = [](int x) {
+        return x * x;
+    };
+    auto bin = [](int x) {
+        return x % 1024;
+    };
+
+    compare("transform",
+            [&] { std::transform(input1.begin(), input1.end(), output.begin(), square); },
+            [&] { algo::transform(input1, output.begin(), square); },
+            threads);
+    compare("copy_if",
+            [&] { std::copy_if(input1.begin(), input1.end(), output.begin(), is_even); },
+            [&] { algo::copy_if(input1, output.begin(), is_even); },
+            threads);
+    compare("stable_partition",
+            [&] {
+                output = input1;
+                std::stable_partition(output.begin(), output.end(), is_even);
+            },
+            [&] {
+                output = input1;
+                algo::stable_partition(output, is_even);
+            },
+            threads);
+    compare("unique_copy",
+            [&] { std::unique_copy(sorted1.begin(), sorted1.end(), output.begin()); },
+            [&] { algo::unique_copy(sorted1, output.begin()); },
+            threads);
+    compare("merge",
+            [&] { std::merge(sorted1.begin(), sorted1.end(), sorted2.begin(), sorted2.end(), output.begin()); },
+            [&] { algo::merge(sorted1, sorted2, output.begin()); },
+            threads);
+    compare("set_union",
+            [&] { std::set_union(sorted1.begin(), sorted1.end(), sorted2.begin(), sorted2.end(), output.begin()); },
+            [&] { algo::set_union(sorted1, sorted2, output.begin()); },
+            threads);
+    compare("set_intersection",
+            [&] {
+                std::set_intersection(
+                    sorted1.begin(), sorted1.end(), sorted2.begin(), sorted2.end(), output.begin());
+            },
+            [&] { algo::set_intersection(sorted1, sorted2, output.begin()); },
+            threads);
+    compare("nth_element",
+            [&] {
+                output = input1;
+                std::nth_element(output.begin(), output.begin() + output.size() / 2, output.end());
+            },
+            [&] {
+                output = input1;
+                algo::nth_element(output, output.begin() + output.size() / 2);
+            },
+            threads);
+    compare("top_k (k = 100)",
+            [&] {
+                std::partial_sort_copy(input1.begin(), input1.end(), output.begin(), output.begin() + 100);
+            },
+            [&] { algo::top_k(input1, 100, output.begin()); },
+            threads);
+    std::vector<std::size_t> counts(1024);
+    compare("histogram (1024 bins)",
+            [&] {
+                std::fill(counts.begin(), counts.end(), 0);
+                for (int x : input1) {
+                    ++counts[bin(x)];
+                }
+            },
+            [&] { algo::histogram(input1, counts, bin); },
+            threads);
+}
+
+int main(int argc, char* argv[]) {
+    utility::thread_number_range threads(utility::get_default_num_threads);
+    oneapi::tbb::tick_count main_start = oneapi::tbb::tick_count::now();
+    parse_command_line(argc, argv, threads);
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, int(num_elements));
+    input1.resize(num_elements);
+    input2.resize(num_elements);
+    for (std::size_t i = 0; i < num_elements; ++i) {
+        input1[i] = dist(gen);
+        input2[i] = dist(gen);
+    }
+    sorted1 = input1;
+    sorted2 = input2;
+    std::sort(sorted1.begin(), sorted1.end());
+    std::sort(sorted2.begin(), sorted2.end());
+    output.resize(2 * num_elements);
+
+    for (int p = threads.first; p <= threads.last; p = threads.step(p)) {
+        oneapi::tbb::global_control c(oneapi::tbb::global_control::max_allowed_parallelism, p);
+        run_all(p);
+    }
+    utility::report_elapsed_time((oneapi::tbb::tick_count::now() - main_start).seconds());
+
+    return 0;
+}
@@ -0,0 +1,795 @@
+/*
+    Copyright (c) 2025 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef __TBB_algorithms_H
+#define __TBB_algorithms_H
+
+#if ! TBB_PREVIEW_ALGORITHMS
+    #error Set TBB_PREVIEW_ALGORITHMS to include algorithms.h
+#endif
+
+#include "detail/_config.h"
+#include "detail/_namespace_injection.h"
+#include "detail/_template_helpers.h"
+
+#include "blocked_range.h"
+#include "parallel_for.h"
+#include "parallel_reduce.h"
+#include "parallel_scan.h"
+#include "task_arena.h"
+
+#include <algorithm>  // for std::merge, std::set_union, std::nth_element, ...
+#include <cstddef>    // for std::size_t
+#include <functional> // for std::less, std::equal_to
+#include <iterator>   // for std::iterator_traits, std::begin, std::end
+#include <type_traits>
+#include <utility>    // for std::pair, std::move
+#include <vector>
+
+namespace tbb {
+namespace detail {
+namespace d1 {
+namespace algorithms {
+
+//! Sequences shorter than this are processed by the serial algorithm
+static constexpr std::size_t serial_cutoff = 2048;
+
+template <typename It>
+using iterator_value_t = typename std::iterator_traits<It>::value_type;
+
+template <typename It>
+using iterator_difference_t = typename std::iterator_traits<It>::difference_type;
+
+template <typename It>
+using has_iterator_category = typename std::iterator_traits<It>::iterator_category;
+
+template <typename R>
+using has_begin_and_end = decltype(std::begin(std::declval<R&>()), std::end(std::declval<R&>()));
+
+template <typename It>
+using enable_if_iterator_t = typename std::enable_if<supports<It, has_iterator_category>::value, int>::type;
+
+template <typename R>
+using enable_if_range_t = typename std::enable_if<supports<typename std::remove_reference<R>::type,
+                                                           has_begin_and_end>::value, int>::type;
+
+template <typename R>
+using range_iterator_t = decltype(std::begin(std::declval<R&>()));
+
+template <typename It>
+void check_random_access() {
+    static_assert(std::is_base_of<std::random_access_iterator_tag,
+                                  typename std::iterator_traits<It>::iterator_category>::value,
+                  "tbb::algorithms require random access iterators");
+}
+
+//! Output iterator that only counts the assignments
+class counting_output_iterator {
+    std::size_t* my_count;
+public:
+    using iterator_category = std::output_iterator_tag;
+    using value_type = void;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = void;
+
+    explicit counting_output_iterator( std::size_t& count ) : my_count(&count) {}
+
+    counting_output_iterator& operator*() { return *this; }
+    counting_output_iterator& operator++() { return *this; }
+    counting_output_iterator& operator++( int ) { return *this; }
+
+    template <typename T>
+    counting_output_iterator& operator=( const T& ) {
+        ++*my_count;
+        return *this;
+    }
+};
+
+//! Moves [first, first + n) into a temporary buffer and returns it
+template <typename It>
+std::vector<iterator_value_t<It>> move_to_buffer( It first, std::size_t n ) {
+    std::vector<iterator_value_t<It>> buffer(n);
+    parallel_for(blocked_range<std::size_t>(0, n), [&buffer, first]( const blocked_range<std::size_t>& r ) {
+        std::move(first + r.begin(), first + r.end(), buffer.begin() + r.begin());
+    });
+    return buffer;
+}
+
+//! Moves the first n elements of the buffer back to the sequence starting at out
+template <typename T, typename It>
+void move_from_buffer( std::vector<T>& buffer, std::size_t n, It out ) {
+    parallel_for(blocked_range<std::size_t>(0, n), [&buffer, out]( const blocked_range<std::size_t>& r ) {
+        std::move(buffer.begin() + r.begin(), buffer.begin() + r.end(), out + r.begin());
+    });
+}
+
+//------------------------------------------------------------------------
+// transform
+//------------------------------------------------------------------------
+
+//! Applies op to every element of [first, last) and stores the results starting at out
+template <typename InputIt, typename OutputIt, typename UnaryOp, enable_if_iterator_t<InputIt> = 0>
+OutputIt transform( InputIt first, InputIt last, OutputIt out, UnaryOp op ) {
+    check_random_access<InputIt>();
+    check_random_access<OutputIt>();
+    std::size_t n = std::size_t(last - first);
+    parallel_for(blocked_range<std::size_t>(0, n), [first, out, &op]( const blocked_range<std::size_t>& r ) {
+        for (std::size_t i = r.begin(); i != r.end(); ++i) {
+            out[i] = op(first[i]);
+        }
+    });
+    return out + n;
+}
+
+//! Applies op to the pairs of elements of [first1, last1) and [first2, ...)
+template <typename InputIt1, typename InputIt2, typename OutputIt, typename BinaryOp, enable_if_iterator_t<InputIt1> = 0>
+OutputIt transform( InputIt1 first1, InputIt1 last1, InputIt2 first2, OutputIt out, BinaryOp op ) {
+    check_random_access<InputIt1>();
+    check_random_access<InputIt2>();
+    check_random_access<OutputIt>();
+    std::size_t n = std::size_t(last1 - first1);
+    parallel_for(blocked_range<std::size_t>(0, n), [first1, first2, out, &op]( const blocked_range<std::size_t>& r ) {
+        for (std::size_t i = r.begin(); i != r.end(); ++i) {
+            out[i] = op(first1[i], first2[i]);
+        }
+    });
+    return out + n;
+}
+
+template <typename Range, typename OutputIt, typename UnaryOp, enable_if_range_t<Range> = 0>
+OutputIt transform( Range&& range, OutputIt out, UnaryOp op ) {
+    return d1::algorithms::transform(std::begin(range), std::end(range), out, op);
+}
+
+//------------------------------------------------------------------------
+// Scan-based compaction: copy_if, partition_copy, unique_copy
+//------------------------------------------------------------------------
+
+//! Copies the elements satisfying pred preserving their relative order
+template <typename InputIt, typename OutputIt, typename Predicate, enable_if_iterator_t<InputIt> = 0>
+OutputIt copy_if( InputIt first, InputIt last, OutputIt out, Predicate pred ) {
+    check_random_access<InputIt>();
+    check_random_access<OutputIt>();
+    std::size_t n = std::size_t(last - first);
+    std::size_t total = parallel_scan(blocked_range<std::size_t>(0, n), std::size_t(0),
+        [first, out, &pred]( const blocked_range<std::size_t>& r, std::size_t offset, bool is_final_scan ) {
+            for (std::size_t i = r.begin(); i != r.end(); ++i) {
+                if (pred(first[i])) {
+                    if (is_final_scan) {
+                        out[offset] = first[i];
+                    }
+                    ++offset;
+                }
+            }
+            return offset;
+        },
+        std::plus<std::size_t>()
+    );
+    return out + total;
+}
+
+template <typename Range, typename OutputIt, typename Predicate, enable_if_range_t<Range> = 0>
+OutputIt copy_if( Range&& range, OutputIt out, Predicate pred ) {
+    return d1::algorithms::copy_if(std::begin(range), std::end(range), out, pred);
+}
+
+using partition_counts = std::pair<std::size_t, std::size_t>;
+
+inline partition_counts join_partition_counts( const partition_counts& left, const partition_counts& right ) {
+    return partition_counts(left.first + right.first, left.second + right.second);
+}
+
+//! Copies the elements satisfying pred to out_true and the rest to out_false, both stably
+template <typename InputIt, typename OutputIt1, typename OutputIt2, typename Predicate, enable_if_iterator_t<InputIt> = 0>
+std::pair<OutputIt1, OutputIt2> partition_copy( InputIt first, InputIt last, OutputIt1 out_true, OutputIt2 out_false,
+                                                Predicate pred ) {
+    check_random_access<InputIt>();
+    check_random_access<OutputIt1>();
+    check_random_access<OutputIt2>();
+    std::size_t n = std::size_t(last - first);
+    partition_counts total = parallel_scan(blocked_range<std::size_t>(0, n), partition_counts(0, 0),
+        [first, out_true, out_false, &pred]( const blocked_range<std::size_t>& r, partition_counts offsets,
+                                             bool is_final_scan ) {
+            for (std::size_t i = r.begin(); i != r.end(); ++i) {
+                if (pred(first[i])) {
+                    if (is_final_scan) {
+                        out_true[offsets.first] = first[i];
+                    }
+                    ++offsets.first;
+                } else {
+                    if (is_final_scan) {
+                        out_false[offsets.second] = first[i];
+                    }
+                    ++offsets.second;
+                }
+            }
+            return offsets;
+        },
+        join_partition_counts
+    );
+    return std::pair<OutputIt1, OutputIt2>(out_true + total.first, out_false + total.second);
+}
+
+template <typename Range, typename OutputIt1, typename OutputIt2, typename Predicate, enable_if_range_t<Range> = 0>
+std::pair<OutputIt1, OutputIt2> partition_copy( Range&& range, OutputIt1 out_true, OutputIt2 out_false, Predicate pred ) {
+    return d1::algorithms::partition_copy(std::begin(range), std::end(range), out_true, out_false, pred);
+}
+
+//! Copies the elements of [first, last) skipping the ones equal to their predecessor
+template <typename InputIt, typename OutputIt, typename BinaryPredicate, enable_if_iterator_t<InputIt> = 0>
+OutputIt unique_copy( InputIt first, InputIt last, OutputIt out, BinaryPredicate eq ) {
+    check_random_access<InputIt>();
+    check_random_access<OutputIt>();
+    std::size_t n = std::size_t(last - first);
+    std::size_t total = parallel_scan(blocked_range<std::size_t>(0, n), std::size_t(0),
+        [first, out, &eq]( const blocked_range<std::size_t>& r, std::size_t offset, bool is_final_scan ) {
+            for (std::size_t i = r.begin(); i != r.end(); ++i) {
+                if (i == 0 || !eq(first[i - 1], first[i])) {
+                    if (is_final_scan) {
+                        out[offset] = first[i];
+                    }
+                    ++offset;
+                }
+            }
+            return offset;
+        },
+        std::plus<std::size_t>()
+    );
+    return out + total;
+}
+
+template <typename InputIt, typename OutputIt, enable_if_iterator_t<InputIt> = 0>
+OutputIt unique_copy( InputIt first, InputIt last, OutputIt out ) {
+    return d1::algorithms::unique_copy(first, last, out, std::equal_to<iterator_value_t<InputIt>>());
+}
+
+template <typename Range, typename OutputIt, typename BinaryPredicate, enable_if_range_t<Range> = 0>
+OutputIt unique_copy( Range&& range, OutputIt out, BinaryPredicate eq ) {
+    return d1::algorithms::unique_copy(std::begin(range), std::end(range), out, eq);
+}
+
+template <typename Range, typename OutputIt, enable_if_range_t<Range> = 0>
+OutputIt unique_copy( Range&& range, OutputIt out ) {
+    return d1::algorithms::unique_copy(std::begin(range), std::end(range), out);
+}
+
+//------------------------------------------------------------------------
+// In-place compaction: stable_partition, unique
+// The value type must be default constructible and move assignable.
+//------------------------------------------------------------------------
+
+//! Reorders [first, last) so that the elements satisfying pred precede the others, preserving relative order
+template <typename It, typename Predicate, enable_if_iterator_t<It> = 0>
+It stable_partition( It first, It last, Predicate pred ) {
+    check_random_access<It>();
+    std::size_t n = std::size_t(last - first);
+    if (n < serial_cutoff) {
+        return std::stable_partition(first, last, pred);
+    }
+    auto buffer = move_to_buffer(first, n);
+    std::size_t num_true = parallel_reduce(blocked_range<std::size_t>(0, n), std::size_t(0),
+        [&buffer, &pred]( const blocked_range<std::size_t>& r, std::size_t count ) {
+            for (std::size_t i = r.begin(); i != r.end(); ++i) {
+                count += pred(buffer[i]) ? 1 : 0;
+            }
+            return count;
+        },
+        std::plus<std::size_t>()
+    );
+    // The elements are moved out of the buffer only in the final scan, after they are inspected
+    parallel_scan(blocked_range<std::size_t>(0, n), partition_counts(0, 0),
+        [&buffer, &pred, first, num_true]( const blocked_range<std::size_t>& r, partition_counts offsets,
+                                           bool is_final_scan ) {
+            for (std::size_t i = r.begin(); i != r.end(); ++i) {
+                if (pred(buffer[i])) {
+                    if (is_final_scan) {
+                        first[offsets.first] = std::move(buffer[i]);
+                    }
+                    ++offsets.first;
+                } else {
+                    if (is_final_scan) {
+                        first[num_true + offsets.second] = std::move(buffer[i]);
+                    }
+                    ++offsets.second;
+                }
+            }
+            return offsets;
+        },
+        join_partition_counts
+    );
+    return first + num_true;
+}
+
+template <typename Range, typename Predicate, enable_if_range_t<Range> = 0>
+range_iterator_t<Range> stable_partition( Range&& range, Predicate pred ) {
+    return d1::algorithms::stable_partition(std::begin(range), std::end(range), pred);
+}
+
+//! Same as stable_partition; the parallel implementation preserves relative order anyway
+template <typename It, typename Predicate, enable_if_iterator_t<It> = 0>
+It partition( It first, It last, Predicate pred ) {
+    return d1::algorithms::stable_partition(first, last, pred);
+}
+
+template <typename Range, typename Predicate, enable_if_range_t<Range> = 0>
+range_iterator_t<Range> partition( Range&& range, Predicate pred ) {
+    return d1::algorithms::stable_partition(std::begin(range), std::end(range), pred);
+}
+
+//! Removes all but the first element from every group of consecutive equal elements
+template <typename It, typename BinaryPredicate, enable_if_iterator_t<It> = 0>
+It unique( It first, It last, BinaryPredicate eq ) {
+    check_random_access<It>();
+    std::size_t n = std::size_t(last - first);
+    if (n < serial_cutoff) {
+        return std::unique(first, last, eq);
+    }
+    // Compare before moving anything, since neighbours are inspected across subrange boundaries
+    std::vector<char> keep(n);
+    parallel_for(blocked_range<std::size_t>(0, n), [&keep, &eq, first]( const blocked_range<std::size_t>& r ) {
+        for (std::size_t i = r.begin(); i != r.end(); ++i) {
+            keep[i] = i == 0 || !eq(first[i - 1], first[i]);
+        }
+    });
+    std::vector<iterator_value_t<It>> buffer(n);
+    std::size_t total = parallel_scan(blocked_range<std::size_t>(0, n), std::size_t(0),
+        [&keep, &buffer, first]( const blocked_range<std::size_t>& r, std::size_t offset, bool is_final_scan ) {
+            for (std::size_t i = r.begin(); i != r.end(); ++i) {
+                if (keep[i]) {
+                    if (is_final_scan) {
+                        buffer[offset] = std::move(first[i]);
+                    }
+                    ++offset;
+                }
+            }
+            return offset;
+        },
+        std::plus<std::size_t>()
+    );
+    move_from_buffer(buffer, total, first);
+    return first + total;
+}
+
+template <typename It, enable_if_iterator_t<It> = 0>
+It unique( It first, It last ) {
+    return d1::algorithms::unique(first, last, std::equal_to<iterator_value_t<It>>());
+}
+
+template <typename Range, typename BinaryPredicate, enable_if_range_t<Range> = 0>
+range_iterator_t<Range> unique( Range&& range, BinaryPredicate eq ) {
+    return d1::algorithms::unique(std::begin(range), std::end(range), eq);
+}
+
+template <typename Range, enable_if_range_t<Range> = 0>
+range_iterator_t<Range> unique( Range&& range ) {
+    return d1::algorithms::unique(std::begin(range), std::end(range));
+}
+
+//------------------------------------------------------------------------
+// merge
+//------------------------------------------------------------------------
+
+//! Pair of sorted subsequences together with the place of their merged result
+/** Splitting takes the middle of the longer subsequence and the matching bound in the other one,
+    so that elements of the first sequence precede equal elements of the second one. **/
+template <typename It1, typename It2, typename OutputIt, typename Compare>
+class merge_range {
+    It1 my_begin1, my_end1;
+    It2 my_begin2, my_end2;
+    OutputIt my_out;
+    Compare my_comp;
+public:
+    merge_range( It1 begin1, It1 end1, It2 begin2, It2 end2, OutputIt out, Compare comp )
+        : my_begin1(begin1), my_end1(end1), my_begin2(begin2), my_end2(end2), my_out(out), my_comp(comp) {}
+
+    merge_range( merge_range& r, split ) : my_comp(r.my_comp) {
+        It1 mid1;
+        It2 mid2;
+        if (r.my_end1 - r.my_begin1 >= r.my_end2 - r.my_begin2) {
+            mid1 = r.my_begin1 + (r.my_end1 - r.my_begin1) / 2;
+            mid2 = std::lower_bound(r.my_begin2, r.my_end2, *mid1, r.my_comp);
+        } else {
+            mid2 = r.my_begin2 + (r.my_end2 - r.my_begin2) / 2;
+            mid1 = std::upper_bound(r.my_begin1, r.my_end1, *mid2, r.my_comp);
+        }
+        my_begin1 = mid1;
+        my_end1 = r.my_end1;
+        my_begin2 = mid2;
+        my_end2 = r.my_end2;
+        my_out = r.my_out + (mid1 - r.my_begin1) + (mid2 - r.my_begin2);
+        r.my_end1 = mid1;
+        r.my_end2 = mid2;
+    }
+
+    bool empty() const { return my_begin1 == my_end1 && my_begin2 == my_end2; }
+
+    bool is_divisible() const {
+        return std::size_t((my_end1 - my_begin1) + (my_end2 - my_begin2)) > serial_cutoff;
+    }
+
+    void merge() const {
+        std::merge(my_begin1, my_end1, my_begin2, my_end2, my_out, my_comp);
+    }
+};
+
+//! Merges two sorted sequences into the sequence starting at out, stably
+template <typename InputIt1, typename InputIt2, typename OutputIt, typename Compare, enable_if_iterator_t<InputIt1> = 0>
+OutputIt merge( InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, OutputIt out, Compare comp ) {
+    check_random_access<InputIt1>();
+    check_random_access<InputIt2>();
+    check_random_access<OutputIt>();
+    using range_type = merge_range<InputIt1, InputIt2, OutputIt, Compare>;
+    parallel_for(range_type(first1, last1, first2, last2, out, comp), []( const range_type& r ) {
+        r.merge();
+    });
+    return out + (last1 - first1) + (last2 - first2);
+}
+
+template <typename InputIt1, typename InputIt2, typename OutputIt, enable_if_iterator_t<InputIt1> = 0>
+OutputIt merge( InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, OutputIt out ) {
+    return d1::algorithms::merge(first1, last1, first2, last2, out, std::less<iterator_value_t<InputIt1>>());
+}
+
+template <typename Range1, typename Range2, typename OutputIt, typename Compare, enable_if_range_t<Range1> = 0>
+OutputIt merge( Range1&& range1, Range2&& range2, OutputIt out, Compare comp ) {
+    return d1::algorithms::merge(std::begin(range1), std::end(range1), std::begin(range2), std::end(range2), out, comp);
+}
+
+template <typename Range1, typename Range2, typename OutputIt, enable_if_range_t<Range1> = 0>
+OutputIt merge( Range1&& range1, Range2&& range2, OutputIt out ) {
+    return d1::algorithms::merge(std::begin(range1), std::end(range1), std::begin(range2), std::end(range2), out);
+}
+
+//------------------------------------------------------------------------
+// Set operations
+//------------------------------------------------------------------------
+
+//! Runs a serial set operation on blocks of both sequences that hold disjoint intervals of values
+/** Every block boundary is the lower bound of the same value in both sequences, so equivalent
+    elements are never separated. The first pass counts the output of each block; the second pass
+    writes it at the offsets given by the counts. **/
+template <typename InputIt1, typename InputIt2, typename OutputIt, typename Compare, typename SetOperation>
+OutputIt parallel_set_operation( InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, OutputIt out,
+                                 Compare comp, SetOperation set_operation )
+{
+    check_random_access<InputIt1>();
+    check_random_access<InputIt2>();
+    check_random_access<OutputIt>();
+    std::size_t n1 = std::size_t(last1 - first1);
+    std::size_t n2 = std::size_t(last2 - first2);
+    if (n1 + n2 < serial_cutoff) {
+        return set_operation(first1, last1, first2, last2, out, comp);
+    }
+
+    std::size_t num_blocks = std::min((n1 + n2) / serial_cutoff + 1, std::size_t(max_concurrency()) * 4);
+    std::vector<std::pair<InputIt1, InputIt2>> bounds(num_blocks + 1);
+    bounds.front() = std::make_pair(first1, first2);
+    bounds.back() = std::make_pair(last1, last2);
+    parallel_for(blocked_range<std::size_t>(1, num_blocks), [&]( const blocked_range<std::size_t>& r ) {
+        for (std::size_t k = r.begin(); k != r.end(); ++k) {
+            if (n1 >= n2) {
+                const auto& value = first1[k * n1 / num_blocks];
+                bounds[k] = std::make_pair(std::lower_bound(first1, last1, value, comp),
+                                           std::lower_bound(first2, last2, value, comp));
+            } else {
+                const auto& value = first2[k * n2 / num_blocks];
+                bounds[k] = std::make_pair(std::lower_bound(first1, last1, value, comp),
+                                           std::lower_bound(first2, last2, value, comp));
+            }
+        }
+    });
+
+    std::vector<std::size_t> offsets(num_blocks + 1, 0);
+    parallel_for(blocked_range<std::size_t>(0, num_blocks), [&]( const blocked_range<std::size_t>& r ) {
+        for (std::size_t k = r.begin(); k != r.end(); ++k) {
+            set_operation(bounds[k].first, bounds[k + 1].first, bounds[k].second, bounds[k + 1].second,
+                          counting_output_iterator(offsets[k + 1]), comp);
+        }
+    });
+    for (std::size_t k = 1; k <= num_blocks; ++k) {
+        offsets[k] += offsets[k - 1];
+    }
+    parallel_for(blocked_range<std::size_t>(0, num_blocks), [&]( const blocked_range<std::size_t>& r ) {
+        for (std::size_t k = r.begin(); k != r.end(); ++k) {
+            set_operation(bounds[k].first, bounds[k + 1].first, bounds[k].second, bounds[k + 1].second,
+                          out + offsets[k], comp);
+        }
+    });
+    return out + offsets.back();
+}
+
+#define __TBB_ALGORITHMS_DEFINE_SET_OPERATION(name)                                                                    \
+struct name##_operation {                                                                                              \
+    template <typename InputIt1, typename InputIt2, typename OutputIt, typename Compare>                               \
+    OutputIt operator()( InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, OutputIt out,               \
+                         Compare comp ) const {                                                                        \
+        return std::name(first1, last1, first2, last2, out, comp);                                                     \
+    }                                                                                                                  \
+};                                                                                                                     \
+                                                                                                                       \
+template <typename InputIt1, typename InputIt2, typename OutputIt, typename Compare, enable_if_iterator_t<InputIt1> = 0> \
+OutputIt name( InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, OutputIt out, Compare comp ) {       \
+    return parallel_set_operation(first1, last1, first2, last2, out, comp, name##_operation());                        \
+}                                                                                                                      \
+                                                                                                                       \
+template <typename InputIt1, typename InputIt2, typename OutputIt, enable_if_iterator_t<InputIt1> = 0>                 \
+OutputIt name( InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, OutputIt out ) {                     \
+    return parallel_set_operation(first1, last1, first2, last2, out, std::less<iterator_value_t<InputIt1>>(),         \
+                                  name##_operation());                                                                 \
+}                                                                                                                      \
+                                                                                                                       \
+template <typename Range1, typename Range2, typename OutputIt, typename Compare, enable_if_range_t<Range1> = 0>        \
+OutputIt name( Range1&& range1, Range2&& range2, OutputIt out, Compare comp ) {                                        \
+    return d1::algorithms::name(std::begin(range1), std::end(range1), std::begin(range2), std::end(range2), out, comp); \
+}                                                                                                                      \
+                                                                                                                       \
+template <typename Range1, typename Range2, typename OutputIt, enable_if_range_t<Range1> = 0>                         \
+OutputIt name( Range1&& range1, Range2&& range2, OutputIt out ) {                                                      \
+    return d1::algorithms::name(std::begin(range1), std::end(range1), std::begin(range2), std::end(range2), out);     \
+}
+
+__TBB_ALGORITHMS_DEFINE_SET_OPERATION(set_union)
+__TBB_ALGORITHMS_DEFINE_SET_OPERATION(set_intersection)
+__TBB_ALGORITHMS_DEFINE_SET_OPERATION(set_difference)
+__TBB_ALGORITHMS_DEFINE_SET_OPERATION(set_symmetric_difference)
+
+#undef __TBB_ALGORITHMS_DEFINE_SET_OPERATION
+
+//------------------------------------------------------------------------
+// Selection: nth_element, top_k
+//------------------------------------------------------------------------
+
+//! Rearranges [first, last) so that nth holds the element that would be there if the sequence were sorted
+/** Each round partitions the sequence around a sampled pivot into the elements less than,
+    equivalent to, and greater than the pivot with a scan, and continues with the part holding nth.
+    The value type must be default constructible and move assignable. **/
+template <typename It, typename Compare, enable_if_iterator_t<It> = 0>
+void nth_element( It first, It nth, It last, Compare comp ) {
+    check_random_access<It>();
+    if (nth == last) {
+        return;
+    }
+    using value_type = iterator_value_t<It>;
+    std::vector<value_type> buffer;
+    while (std::size_t(last - first) >= serial_cutoff) {
+        std::size_t n = std::size_t(last - first);
+
+        constexpr std::size_t num_samples = 31;
+        std::vector<value_type> samples;
+        samples.reserve(num_samples);
+        for (std::size_t s = 0; s < num_samples; ++s) {
+            samples.push_back(first[(2 * s + 1) * n / (2 * num_samples)]);
+        }
+        std::nth_element(samples.begin(), samples.begin() + num_samples / 2, samples.end(), comp);
+        const value_type pivot = samples[num_samples / 2];
+
+        // Counts of elements less than and equivalent to the pivot
+        partition_counts totals = parallel_reduce(blocked_range<std::size_t>(0, n), partition_counts(0, 0),
+            [first, &pivot, &comp]( const blocked_range<std::size_t>& r, partition_counts counts ) {
+                for (std::size_t i = r.begin(); i != r.end(); ++i) {
+                    if (comp(first[i], pivot)) {
+                        ++counts.first;
+                    } else if (!comp(pivot, first[i])) {
+                        ++counts.second;
+                    }
+                }
+                return counts;
+            },
+            join_partition_counts
+        );
+        std::size_t num_less = totals.first;
+        std::size_t num_equal = totals.second;
+
+        buffer.resize(n);
+        parallel_scan(blocked_range<std::size_t>(0, n), partition_counts(0, 0),
+            [&]( const blocked_range<std::size_t>& r, partition_counts offsets, bool is_final_scan ) {
+                for (std::size_t i = r.begin(); i != r.end(); ++i) {
+                    if (comp(first[i], pivot)) {
+                        if (is_final_scan) {
+                            buffer[offsets.first] = std::move(first[i]);
+                        }
+                        ++offsets.first;
+                    } else if (!comp(pivot, first[i])) {
+                        if (is_final_scan) {
+                            buffer[num_less + offsets.second] = std::move(first[i]);
+                        }
+                        ++offsets.second;
+                    } else if (is_final_scan) {
+                        buffer[num_less + num_equal + (i - offsets.first - offsets.second)] = std::move(first[i]);
+                    }
+                }
+                return offsets;
+            },
+            join_partition_counts
+        );
+        move_from_buffer(buffer, n, first);
+
+        std::size_t k = std::size_t(nth - first);
+        if (k < num_less) {
+            last = first + num_less;
+        } else if (k < num_less + num_equal) {
+            return;
+        } else {
+            first += num_less + num_equal;
+        }
+    }
+    std::nth_element(first, nth, last, comp);
+}
+
+template <typename It, enable_if_iterator_t<It> = 0>
+void nth_element( It first, It nth, It last ) {
+    d1::algorithms::nth_element(first, nth, last, std::less<iterator_value_t<It>>());
+}
+
+template <typename Range, typename Compare, enable_if_range_t<Range> = 0>
+void nth_element( Range&& range, range_iterator_t<Range> nth, Compare comp ) {
+    d1::algorithms::nth_element(std::begin(range), nth, std::end(range), comp);
+}
+
+template <typename Range, enable_if_range_t<Range> = 0>
+void nth_element( Range&& range, range_iterator_t<Range> nth ) {
+    d1::algorithms::nth_element(std::begin(range), nth, std::end(range));
+}
+
+//! Keeps the k least elements of the processed subranges in a heap
+template <typename It, typename Compare>
+class top_k_body {
+    It my_first;
+    std::size_t my_k;
+    Compare my_comp;
+public:
+    //! Max-heap with respect to my_comp
+    std::vector<iterator_value_t<It>> my_heap;
+
+    top_k_body( It first, std::size_t k, Compare comp ) : my_first(first), my_k(k), my_comp(comp) {}
+    top_k_body( top_k_body& other, split ) : my_first(other.my_first), my_k(other.my_k), my_comp(other.my_comp) {}
+
+    void add( const iterator_value_t<It>& value ) {
+        if (my_heap.size() < my_k) {
+            my_heap.push_back(value);
+            std::push_heap(my_heap.begin(), my_heap.end(), my_comp);
+        } else if (my_comp(value, my_heap.front())) {
+            std::pop_heap(my_heap.begin(), my_heap.end(), my_comp);
+            my_heap.back() = value;
+            std::push_heap(my_heap.begin(), my_heap.end(), my_comp);
+        }
+    }
+
+    void operator()( const blocked_range<std::size_t>& r ) {
+        if (my_heap.capacity() < my_k) {
+            my_heap.reserve(my_k);
+        }
+        for (std::size_t i = r.begin(); i != r.end(); ++i) {
+            add(my_first[i]);
+        }
+    }
+
+    void join( top_k_body& rhs ) {
+        for (const auto& value : rhs.my_heap) {
+            add(value);
+        }
+    }
+};
+
+//! Copies the k least elements of [first, last) in ascending order to out
+/** Intended for k much smaller than the length of the sequence. **/
+template <typename InputIt, typename OutputIt, typename Compare, enable_if_iterator_t<InputIt> = 0>
+OutputIt top_k( InputIt first, InputIt last, std::size_t k, OutputIt out, Compare comp ) {
+    check_random_access<InputIt>();
+    std::size_t n = std::size_t(last - first);
+    if (k == 0 || n == 0) {
+        return out;
+    }
+    top_k_body<InputIt, Compare> body(first, k, comp);
+    parallel_reduce(blocked_range<std::size_t>(0, n, std::max(k, serial_cutoff)), body);
+    std::sort_heap(body.my_heap.begin(), body.my_heap.end(), comp);
+    return std::move(body.my_heap.begin(), body.my_heap.end(), out);
+}
+
+template <typename InputIt, typename OutputIt, enable_if_iterator_t<InputIt> = 0>
+OutputIt top_k( InputIt first, InputIt last, std::size_t k, OutputIt out ) {
+    return d1::algorithms::top_k(first, last, k, out, std::less<iterator_value_t<InputIt>>());
+}
+
+template <typename Range, typename OutputIt, typename Compare, enable_if_range_t<Range> = 0>
+OutputIt top_k( Range&& range, std::size_t k, OutputIt out, Compare comp ) {
+    return d1::algorithms::top_k(std::begin(range), std::end(range), k, out, comp);
+}
+
+template <typename Range, typename OutputIt, enable_if_range_t<Range> = 0>
+OutputIt top_k( Range&& range, std::size_t k, OutputIt out ) {
+    return d1::algorithms::top_k(std::begin(range), std::end(range), k, out);
+}
+
+//------------------------------------------------------------------------
+// histogram
+//------------------------------------------------------------------------
+
+//! Accumulates private counts for the processed subranges
+template <typename It, typename BinFunction>
+class histogram_body {
+    It my_first;
+    const BinFunction& my_bin;
+public:
+    std::vector<std::size_t> my_counts;
+
+    histogram_body( It first, std::size_t num_bins, const BinFunction& bin )
+        : my_first(first), my_bin(bin), my_counts(num_bins, 0) {}
+    histogram_body( histogram_body& other, split )
+        : my_first(other.my_first), my_bin(other.my_bin), my_counts(other.my_counts.size(), 0) {}
+
+    void operator()( const blocked_range<std::size_t>& r ) {
+        for (std::size_t i = r.begin(); i != r.end(); ++i) {
+            std::size_t b = std::size_t(my_bin(my_first[i]));
+            if (b < my_counts.size()) {
+                ++my_counts[b];
+            }
+        }
+    }
+
+    void join( histogram_body& rhs ) {
+        for (std::size_t b = 0; b < my_counts.size(); ++b) {
+            my_counts[b] += rhs.my_counts[b];
+        }
+    }
+};
+
+//! Counts the elements of [first, last) falling into each bin of [counts_first, counts_last)
+/** bin maps an element to the index of its bin; the elements mapped outside of the bins are ignored. **/
+template <typename InputIt, typename CountIt, typename BinFunction, enable_if_iterator_t<InputIt> = 0>
+void histogram( InputIt first, InputIt last, CountIt counts_first, CountIt counts_last, BinFunction bin ) {
+    check_random_access<InputIt>();
+    check_random_access<CountIt>();
+    std::size_t num_bins = std::size_t(counts_last - counts_first);
+    histogram_body<InputIt, BinFunction> body(first, num_bins, bin);
+    // Larger subranges amortize merging of the private counts
+    parallel_reduce(blocked_range<std::size_t>(0, std::size_t(last - first), std::max(num_bins, serial_cutoff)), body);
+    std::copy(body.my_counts.begin(), body.my_counts.end(), counts_first);
+}
+
+template <typename Range, typename CountRange, typename BinFunction, enable_if_range_t<Range> = 0>
+void histogram( Range&& range, CountRange&& counts, BinFunction bin ) {
+    d1::algorithms::histogram(std::begin(range), std::end(range), std::begin(counts), std::end(counts), bin);
+}
+
+} // namespace algorithms
+} // namespace d1
+} // namespace detail
+
+inline namespace v1 {
+namespace algorithms {
+    using detail::d1::algorithms::transform;
+    using detail::d1::algorithms::copy_if;
+    using detail::d1::algorithms::partition_copy;
+    using detail::d1::algorithms::unique_copy;
+    using detail::d1::algorithms::stable_partition;
+    using detail::d1::algorithms::partition;
+    using detail::d1::algorithms::unique;
+    using detail::d1::algorithms::merge;
+    using detail::d1::algorithms::set_union;
+    using detail::d1::algorithms::set_intersection;
+    using detail::d1::algorithms::set_difference;
+    using detail::d1::algorithms::set_symmetric_difference;
+    using detail::d1::algorithms::nth_element;
+    using detail::d1::algorithms::top_k;
+    using detail::d1::algorithms::histogram;
+} // namespace algorithms
+} // namespace v1
+
+} // namespace tbb
+
+#endif /* __TBB_algorithms_H */
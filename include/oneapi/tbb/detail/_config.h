@@ -530,6 +530,36 @@
                                                    || TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT)
 #endif
 
+#ifndef __TBB_PREVIEW_FLOW_GRAPH_BATCHING
+#define __TBB_PREVIEW_FLOW_GRAPH_BATCHING (TBB_PREVIEW_FLOW_GRAPH_FEATURES \
+                                           || TBB_PREVIEW_FLOW_GRAPH_BATCHING)
+#endif
+
+// remove_edge does not wait for the messages in flight, so it is not a part of TBB_PREVIEW_FLOW_GRAPH_FEATURES
+#ifndef __TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS
+#define __TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS (TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS)
+#endif
+
+// The fused chains grow the stack of a task, so they are not a part of TBB_PREVIEW_FLOW_GRAPH_FEATURES
+#ifndef __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+#define __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION (TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION)
+#endif
+
+#ifndef __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES
+#define __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES (TBB_PREVIEW_FLOW_GRAPH_FEATURES \
+                                                || TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES)
+#endif
+
+// The binding adds an arena pointer to every node and graph task, so it is not a part of TBB_PREVIEW_FLOW_GRAPH_FEATURES
+#ifndef __TBB_PREVIEW_FLOW_GRAPH_NODE_ARENAS
+#define __TBB_PREVIEW_FLOW_GRAPH_NODE_ARENAS (TBB_PREVIEW_FLOW_GRAPH_NODE_ARENAS)
+#endif
+
+// The statistics cost time on every message, so they are not a part of TBB_PREVIEW_FLOW_GRAPH_FEATURES
+#ifndef __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+#define __TBB_PREVIEW_FLOW_GRAPH_STATISTICS (TBB_PREVIEW_FLOW_GRAPH_STATISTICS)
+#endif
+
 #if TBB_PREVIEW_CONCURRENT_HASH_MAP_EXTENSIONS
 #define __TBB_PREVIEW_CONCURRENT_HASH_MAP_EXTENSIONS 1
 #endif
@@ -542,10 +572,54 @@
 #define __TBB_PREVIEW_PARALLEL_PHASE 1
 #endif
 
+#if TBB_PREVIEW_ARENA_WEIGHTS || __TBB_BUILD
+#define __TBB_PREVIEW_ARENA_WEIGHTS 1
+#endif
+
+#if TBB_PREVIEW_ARENA_WARM_UP
+#define __TBB_PREVIEW_ARENA_WARM_UP 1
+#endif
+
 #if TBB_PREVIEW_BLOCKED_ND_RANGE_DEDUCTION_GUIDES
 #define __TBB_PREVIEW_BLOCKED_ND_RANGE_DEDUCTION_GUIDES 1
 #endif
 
+#if TBB_PREVIEW_PARALLEL_SCAN_SINGLE_PASS
+#define __TBB_PREVIEW_PARALLEL_SCAN_SINGLE_PASS 1
+#endif
+
+#if TBB_PREVIEW_TUNING_PARTITIONER
+#define __TBB_PREVIEW_TUNING_PARTITIONER 1
+#endif
+
+#if TBB_PREVIEW_PREALLOCATED_TASK_TREE
+#define __TBB_PREVIEW_PREALLOCATED_TASK_TREE 1
+#endif
+
+#if TBB_PREVIEW_BANDWIDTH_PARTITIONER
+#define __TBB_PREVIEW_BANDWIDTH_PARTITIONER 1
+#endif
+
+#if TBB_PREVIEW_PARALLEL_FOR_EACH_BATCHING
+#define __TBB_PREVIEW_PARALLEL_FOR_EACH_BATCHING 1
+#endif
+
+#if TBB_PREVIEW_PIPELINE_BATCHING
+#define __TBB_PREVIEW_PIPELINE_BATCHING 1
+#endif
+
+#if TBB_PREVIEW_PIPELINE_LIMITS || __TBB_BUILD
+#define __TBB_PREVIEW_PIPELINE_LIMITS 1
+#endif
+
+#if TBB_PREVIEW_PIPELINE_OBJECT_POOL
+#define __TBB_PREVIEW_PIPELINE_OBJECT_POOL 1
+#endif
+
+#if TBB_PREVIEW_PIPELINE_BRANCHES
+#define __TBB_PREVIEW_PIPELINE_BRANCHES 1
+#endif
+
 #if !__TBB_DISABLE_SPEC_EXTENSIONS
 #define TBB_EXT_CUSTOM_ASSERTION_HANDLER 202510
 #endif
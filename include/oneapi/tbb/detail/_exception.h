@@ -38,6 +38,7 @@ enum class exception_id {
     invalid_key,
     bad_tagged_msg_cast,
     unsafe_wait,
+    no_worker_slots,
     last_entry
 };
 } // namespace d0
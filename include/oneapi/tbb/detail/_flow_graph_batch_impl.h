@@ -0,0 +1,379 @@
+/*
+    Copyright (c) 2025 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef __TBB__flow_graph_batch_impl_H
+#define __TBB__flow_graph_batch_impl_H
+
+#ifndef __TBB_flow_graph_H
+#error Do not #include this internal file directly; use public TBB headers instead.
+#endif
+
+// included in namespace tbb::detail::d2 (in flow_graph.h)
+
+//! A body that is applied to a batch of messages at once
+/** BatchOutput is either the vector of the outputs or the tuple of the output ports. **/
+template <typename Input, typename BatchOutput>
+class batch_body : no_assign {
+public:
+    virtual ~batch_body() {}
+    virtual void operator()(const std::vector<Input>& batch, BatchOutput& output) = 0;
+    virtual batch_body* clone() = 0;
+};
+
+//! the leaf for batch_body
+template <typename Input, typename BatchOutput, typename B>
+class batch_body_leaf : public batch_body<Input, BatchOutput> {
+public:
+    batch_body_leaf( const B& _body ) : body(_body) {}
+    void operator()(const std::vector<Input>& batch, BatchOutput& output) override {
+        tbb::detail::invoke(body, batch, output);
+    }
+    B get_body() { return body; }
+    batch_body_leaf* clone() override {
+        return new batch_body_leaf<Input, BatchOutput, B>(body);
+    }
+private:
+    B body;
+};
+
+//! A task that applies the body of a batch node to the queued messages until there are none
+template <typename NodeType>
+class batch_task_bypass : public graph_task {
+    NodeType& my_node;
+public:
+    batch_task_bypass( graph& g, d1::small_object_allocator& allocator, NodeType& n,
+                       node_priority_t node_priority = no_priority )
+        : graph_task(g, allocator, node_priority), my_node(n) {}
+
+    d1::task* execute(d1::execution_data& ed) override {
+        graph_task* next_task = my_node.apply_body_to_batches_bypass();
+        if (SUCCESSFULLY_ENQUEUED == next_task)
+            next_task = nullptr;
+        else if (next_task)
+            next_task = prioritize_next_task(my_node.graph_reference(), *this, *next_task);
+        finalize<batch_task_bypass>(ed);
+        return next_task;
+    }
+
+    d1::task* cancel(d1::execution_data& ed) override {
+        finalize<batch_task_bypass>(ed);
+        return nullptr;
+    }
+};
+
+//! Input part of the nodes that apply their body to batches of messages
+/** Every message is queued. A task is created for the first message that arrives to an idle node;
+    the task takes up to max_batch_size messages from the queue per call of the body and keeps
+    taking them until the queue is empty. Messages that arrive while the body runs make up the next
+    batch. Another task is started, while the concurrency limit allows, only if the queue holds more
+    messages than the running tasks take in their next batches. The node never rejects messages. **/
+template <typename Input, typename BatchOutput, typename ImplType>
+class batch_input : public receiver<Input>, public node_arena_binding {
+public:
+    typedef Input input_type;
+    typedef std::vector<input_type> batch_type;
+    typedef batch_body<input_type, BatchOutput> batch_body_type;
+    typedef batch_input<Input, BatchOutput, ImplType> class_type;
+    typedef typename receiver<input_type>::predecessor_type predecessor_type;
+
+    template <typename Body>
+    batch_input( graph& g, size_t max_concurrency, size_t max_batch_size, Body& body, node_priority_t a_priority )
+        : my_graph_ref(g), my_max_concurrency(max_concurrency)
+        , my_max_batch_size(max_batch_size > 0 ? max_batch_size : 1), my_concurrency(0)
+        , my_priority(a_priority)
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        , my_statistics(max_concurrency)
+#endif
+        , my_body(new batch_body_leaf<input_type, BatchOutput, Body>(body))
+        , my_init_body(new batch_body_leaf<input_type, BatchOutput, Body>(body)) {}
+
+    //! Copy constructor
+    batch_input( const batch_input& src )
+        : receiver<input_type>(), my_graph_ref(src.my_graph_ref), my_max_concurrency(src.my_max_concurrency)
+        , my_max_batch_size(src.my_max_batch_size), my_concurrency(0), my_priority(src.my_priority)
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        , my_statistics(src.my_max_concurrency)
+#endif
+        , my_body(src.my_init_body->clone()), my_init_body(src.my_init_body->clone()) {}
+
+    ~batch_input() {
+        delete my_body;
+        delete my_init_body;
+    }
+
+    template <typename Body>
+    Body copy_function_object() {
+        batch_body_type& body_ref = *my_body;
+        return dynamic_cast<batch_body_leaf<input_type, BatchOutput, Body>&>(body_ref).get_body();
+    }
+
+    size_t max_batch_size() const { return my_max_batch_size; }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    node_statistics& statistics() { return my_statistics; }
+    const node_statistics& statistics() const { return my_statistics; }
+#endif
+
+    graph& graph_reference() const override { return my_graph_ref; }
+
+    node_priority_t priority() const override { return my_priority; }
+
+    //! Executed by batch_task_bypass; returns the last task created by the successors
+    graph_task* apply_body_to_batches_bypass() {
+        graph_task* last_task = nullptr;
+        batch_type batch;
+        batch.reserve(my_max_batch_size);
+        for (;;) {
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+            message_metainfo metainfo;
+#endif
+            {
+                spin_mutex::scoped_lock lock(my_mutex);
+                if (my_queue.empty()) {
+                    --my_concurrency;
+                    break;
+                }
+                size_t n = my_queue.size() < my_max_batch_size ? my_queue.size() : my_max_batch_size;
+                for (size_t i = 0; i < n; ++i) {
+                    batch.push_back(std::move(my_queue.front()));
+                    my_queue.pop_front();
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+                    metainfo.merge(my_queue_metainfo.front());
+                    my_queue_metainfo.pop_front();
+#endif
+                }
+            }
+            graph_task* successor_task = nullptr;
+            try_call([&] {
+                successor_task = static_cast<ImplType*>(this)->apply_body_impl_bypass(
+                    batch __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+            }).on_exception([&] {
+                // The task stops; the messages left in the queue are discarded by the graph reset
+                {
+                    spin_mutex::scoped_lock lock(my_mutex);
+                    --my_concurrency;
+                }
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+                release_waiters(metainfo);
+#endif
+            });
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+            release_waiters(metainfo);
+#endif
+            last_task = combine_tasks(my_graph_ref, last_task, successor_task);
+            batch.clear();
+        }
+        return last_task;
+    }
+
+protected:
+    template< typename R, typename B > friend class run_and_put_task;
+    template<typename X, typename Y> friend class broadcast_cache;
+    template<typename X, typename Y> friend class round_robin_cache;
+
+    graph_task* try_put_task( const input_type& t ) override {
+        return try_put_task_impl(t __TBB_FLOW_GRAPH_METAINFO_ARG(message_metainfo{}));
+    }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+    graph_task* try_put_task( const input_type& t, const message_metainfo& metainfo ) override {
+        return try_put_task_impl(t, metainfo);
+    }
+#endif
+
+    void reset_batch_input( reset_flags f ) {
+        {
+            spin_mutex::scoped_lock lock(my_mutex);
+            my_queue.clear();
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+            my_queue_metainfo.clear();
+#endif
+            my_concurrency = 0;
+        }
+        if (f & rf_reset_bodies) {
+            batch_body_type* tmp = my_init_body->clone();
+            delete my_body;
+            my_body = tmp;
+        }
+    }
+
+    void apply_body( const batch_type& batch, BatchOutput& output ) {
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        node_statistics::body_scope scope(my_statistics);
+#endif
+        fgt_begin_body(my_body);
+        tbb::detail::invoke(*my_body, batch, output);
+        fgt_end_body(my_body);
+    }
+
+private:
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+    //! The waiters were reserved once per message when the messages were queued
+    static void release_waiters( const message_metainfo& metainfo ) {
+        for (auto waiter : metainfo.waiters()) {
+            waiter->release(1);
+        }
+    }
+#endif
+
+    graph_task* try_put_task_impl( const input_type& t
+                                   __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo) )
+    {
+        if (!is_graph_active(my_graph_ref)) {
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+            my_statistics.record_put(false);
+#endif
+            return nullptr;
+        }
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        my_statistics.record_put(true);
+#endif
+        {
+            spin_mutex::scoped_lock lock(my_mutex);
+            my_queue.push_back(t);
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+            my_statistics.record_queue_size(my_queue.size());
+#endif
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+            // Prolong the wait until the batch with the message is processed
+            for (auto waiter : metainfo.waiters()) {
+                waiter->reserve(1);
+            }
+            my_queue_metainfo.push_back(metainfo);
+#endif
+            bool limited = my_max_concurrency != unlimited && my_concurrency >= my_max_concurrency;
+            if (limited || my_queue.size() <= my_concurrency * my_max_batch_size) {
+                return SUCCESSFULLY_ENQUEUED;
+            }
+            ++my_concurrency;
+        }
+        d1::small_object_allocator allocator{};
+        typedef batch_task_bypass<class_type> task_type;
+        graph_task* task = allocator.new_object<task_type>(my_graph_ref, allocator, *this, my_priority);
+        bind_task(*task);
+        return task;
+    }
+
+    graph& my_graph_ref;
+    const size_t my_max_concurrency;
+    const size_t my_max_batch_size;
+    //! The number of tasks that apply the body
+    size_t my_concurrency;
+    node_priority_t my_priority;
+    spin_mutex my_mutex;
+    std::deque<input_type> my_queue;
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+    std::deque<message_metainfo> my_queue_metainfo;
+#endif
+protected:
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    node_statistics my_statistics;
+#endif
+    batch_body_type* my_body;
+    batch_body_type* my_init_body;
+}; // class batch_input
+
+//! Input part of batch_function_node: forwards the outputs of a batch to the successors in one pass
+template <typename Input, typename Output>
+class batch_function_input
+    : public batch_input<Input, std::vector<Output>, batch_function_input<Input, Output>>
+{
+public:
+    typedef Output output_type;
+    typedef std::vector<output_type> output_batch_type;
+    typedef batch_input<Input, output_batch_type, batch_function_input<Input, Output>> base_type;
+    typedef typename base_type::batch_type batch_type;
+
+    template <typename Body>
+    batch_function_input( graph& g, size_t max_concurrency, size_t max_batch_size, Body& body,
+                          node_priority_t a_priority )
+        : base_type(g, max_concurrency, max_batch_size, body, a_priority) {}
+
+    batch_function_input( const batch_function_input& src ) : base_type(src) {}
+
+    graph_task* apply_body_impl_bypass( const batch_type& batch
+                                        __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo) )
+    {
+        output_batch_type outputs;
+        outputs.reserve(batch.size());
+        this->apply_body(batch, outputs);
+        graph_task* last_task = nullptr;
+        for (const output_type& v : outputs) {
+            graph_task* successor_task = successors().try_put_task(v __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+            last_task = combine_tasks(this->graph_reference(), last_task, successor_task);
+        }
+        return last_task;
+    }
+
+protected:
+    virtual broadcast_cache<output_type>& successors() = 0;
+}; // class batch_function_input
+
+//! Input part of batch_multifunction_node: the body puts the outputs to the ports itself
+template <typename Input, typename OutputPortSet>
+class batch_multifunction_input
+    : public batch_input<Input, OutputPortSet, batch_multifunction_input<Input, OutputPortSet>>
+{
+public:
+    static const int N = std::tuple_size<OutputPortSet>::value;
+    typedef OutputPortSet output_ports_type;
+    typedef batch_input<Input, output_ports_type, batch_multifunction_input<Input, OutputPortSet>> base_type;
+    typedef typename base_type::batch_type batch_type;
+
+    template <typename Body>
+    batch_multifunction_input( graph& g, size_t max_concurrency, size_t max_batch_size, Body& body,
+                               node_priority_t a_priority )
+        : base_type(g, max_concurrency, max_batch_size, body, a_priority)
+        , my_output_ports(init_output_ports<output_ports_type>::call(g, my_output_ports)) {
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        statistics_ports<N>::set_statistics(my_output_ports, &this->my_statistics);
+#endif
+    }
+
+    batch_multifunction_input( const batch_multifunction_input& src )
+        : base_type(src)
+        , my_output_ports(init_output_ports<output_ports_type>::call(src.graph_reference(), my_output_ports)) {
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        statistics_ports<N>::set_statistics(my_output_ports, &this->my_statistics);
+#endif
+    }
+
+    output_ports_type& output_ports() { return my_output_ports; }
+
+    //! The outputs put by the body do not carry the metainfo of the batch, as for multifunction_node
+    /** So the waiters of try_put_and_wait are released when the body returns; they do not wait
+        for the successors. **/
+    graph_task* apply_body_impl_bypass( const batch_type& batch
+                                        __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo&) )
+    {
+        this->apply_body(batch, my_output_ports);
+        return SUCCESSFULLY_ENQUEUED;
+    }
+
+protected:
+    void reset( reset_flags f ) {
+        this->reset_batch_input(f);
+        if (f & rf_clear_edges) {
+            clear_element<N>::clear_this(my_output_ports);
+        }
+        __TBB_ASSERT(!(f & rf_clear_edges) || clear_element<N>::this_empty(my_output_ports),
+                     "batch_multifunction_node reset failed");
+    }
+
+    output_ports_type my_output_ports;
+}; // class batch_multifunction_input
+
+#endif // __TBB__flow_graph_batch_impl_H
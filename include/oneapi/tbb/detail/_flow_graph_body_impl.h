@@ -259,7 +259,7 @@ public:
         if (SUCCESSFULLY_ENQUEUED == next_task)
             next_task = nullptr;
         else if (next_task)
-            next_task = prioritize_task(my_node.graph_reference(), *next_task);
+            next_task = prioritize_next_task(my_node.graph_reference(), *this, *next_task);
         finalize<forward_task_bypass>(ed);
         return next_task;
     }
@@ -301,22 +301,23 @@ class apply_body_task_bypass
 public:
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
     template <typename Metainfo>
-    apply_body_task_bypass( graph& g, d1::small_object_allocator& allocator, NodeType &n, const Input &i,
+    apply_body_task_bypass( graph& g, d1::small_object_allocator& allocator, NodeType &n, Input i,
                             node_priority_t node_priority, Metainfo&& metainfo )
         : BaseTaskType(g, allocator, node_priority, std::forward<Metainfo>(metainfo).waiters())
-        , my_node(n), my_input(i) {}
+        , my_node(n), my_input(std::move(i)) {}
 #endif
 
-    apply_body_task_bypass( graph& g, d1::small_object_allocator& allocator, NodeType& n, const Input& i,
+    // The input is taken by value, so the inputs put as rvalues are moved into the task
+    apply_body_task_bypass( graph& g, d1::small_object_allocator& allocator, NodeType& n, Input i,
                             node_priority_t node_priority = no_priority )
-        : BaseTaskType(g, allocator, node_priority), my_node(n), my_input(i) {}
+        : BaseTaskType(g, allocator, node_priority), my_node(n), my_input(std::move(i)) {}
 
     d1::task* execute(d1::execution_data& ed) override {
         graph_task* next_task = call_apply_body_bypass();
         if (SUCCESSFULLY_ENQUEUED == next_task)
             next_task = nullptr;
         else if (next_task)
-            next_task = prioritize_task(my_node.graph_reference(), *next_task);
+            next_task = prioritize_next_task(my_node.graph_reference(), *this, *next_task);
         BaseTaskType::template finalize<apply_body_task_bypass>(ed);
         return next_task;
     }
@@ -340,7 +341,7 @@ public:
         if (SUCCESSFULLY_ENQUEUED == next_task)
             next_task = nullptr;
         else if (next_task)
-            next_task = prioritize_task(my_node.graph_reference(), *next_task);
+            next_task = prioritize_next_task(my_node.graph_reference(), *this, *next_task);
         finalize<input_node_task_bypass>(ed);
         return next_task;
     }
@@ -252,6 +252,174 @@ private:
     std::atomic<predecessor_type*> reserved_src;
 };
 
+#if __TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS
+//! Copy-on-write list of successors that is read without locking
+/** Readers iterate over an immutable snapshot of the list. A writer, which holds the mutex of the
+    cache, publishes a modified copy and retires the previous snapshot. The retired snapshots are
+    deleted once there are no active readers, either by the next writer or by the last reader. */
+template <typename Pointer, typename Mutex>
+class successor_snapshots : no_copy {
+    struct snapshot {
+        std::vector<Pointer> items;
+        snapshot* next_retired{nullptr};
+    };
+
+public:
+    //! Pins the current snapshot for iteration
+    class reader : no_copy {
+    public:
+        explicit reader( successor_snapshots& list ) : my_list(list) {
+            // The increment must precede the load so that a writer that sees no readers
+            // after publishing a snapshot may delete the previous ones
+            my_list.my_readers.fetch_add(1);
+            my_snapshot = my_list.my_current.load();
+        }
+
+        ~reader() {
+            if (my_list.my_readers.fetch_sub(1) == 1 &&
+                my_list.my_retired.load(std::memory_order_relaxed) != nullptr) {
+                my_list.try_reclaim();
+            }
+        }
+
+        const Pointer* begin() const { return my_snapshot ? my_snapshot->items.data() : nullptr; }
+        const Pointer* end() const { return my_snapshot ? my_snapshot->items.data() + my_snapshot->items.size() : nullptr; }
+        std::size_t size() const { return my_snapshot ? my_snapshot->items.size() : 0; }
+
+    private:
+        successor_snapshots& my_list;
+        snapshot* my_snapshot;
+    };
+
+    explicit successor_snapshots( Mutex& m ) : my_mutex(m) {}
+
+    ~successor_snapshots() {
+        delete my_current.load(std::memory_order_relaxed);
+        delete_retired();
+    }
+
+    bool empty() {
+        reader r(*this);
+        return r.size() == 0;
+    }
+
+    std::size_t size() {
+        reader r(*this);
+        return r.size();
+    }
+
+    // The modifiers must be called with the mutex acquired for writing
+
+    void push_front( Pointer p ) {
+        snapshot* s = new snapshot;
+        s->items.reserve(current_size() + 1);
+        s->items.push_back(p);
+        append_current(*s);
+        publish(s);
+    }
+
+    void push_back( Pointer p ) {
+        snapshot* s = new snapshot;
+        s->items.reserve(current_size() + 1);
+        append_current(*s);
+        s->items.push_back(p);
+        publish(s);
+    }
+
+    //! Removes the first occurrence of p; returns false if there is none
+    bool erase( Pointer p ) {
+        snapshot* current = my_current.load(std::memory_order_relaxed);
+        if (!contains(p)) {
+            return false;
+        }
+        snapshot* s = nullptr;
+        if (current->items.size() > 1) {
+            s = new snapshot;
+            s->items.reserve(current->items.size() - 1);
+            bool erased = false;
+            for (Pointer item : current->items) {
+                if (item == p && !erased) {
+                    erased = true;
+                } else {
+                    s->items.push_back(item);
+                }
+            }
+        }
+        publish(s);
+        return true;
+    }
+
+    bool contains( Pointer p ) const {
+        snapshot* current = my_current.load(std::memory_order_relaxed);
+        if (current) {
+            for (Pointer item : current->items) {
+                if (item == p) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void clear() {
+        if (my_current.load(std::memory_order_relaxed)) {
+            publish(nullptr);
+        }
+    }
+
+private:
+    std::size_t current_size() const {
+        snapshot* current = my_current.load(std::memory_order_relaxed);
+        return current ? current->items.size() : 0;
+    }
+
+    void append_current( snapshot& s ) const {
+        snapshot* current = my_current.load(std::memory_order_relaxed);
+        if (current) {
+            s.items.insert(s.items.end(), current->items.begin(), current->items.end());
+        }
+    }
+
+    void publish( snapshot* s ) {
+        snapshot* previous = my_current.exchange(s);
+        if (previous) {
+            previous->next_retired = my_retired.load(std::memory_order_relaxed);
+            my_retired.store(previous, std::memory_order_relaxed);
+        }
+        reclaim_if_quiescent();
+    }
+
+    //! Called by the last reader, which does not wait for the writers
+    void try_reclaim() {
+        typename Mutex::scoped_lock lock;
+        if (lock.try_acquire(my_mutex, /*write=*/true)) {
+            reclaim_if_quiescent();
+        }
+    }
+
+    //! The readers that started after the snapshots were retired do not see them
+    void reclaim_if_quiescent() {
+        if (my_readers.load() == 0) {
+            delete_retired();
+        }
+    }
+
+    void delete_retired() {
+        snapshot* s = my_retired.load(std::memory_order_relaxed);
+        my_retired.store(nullptr, std::memory_order_relaxed);
+        while (s) {
+            snapshot* next = s->next_retired;
+            delete s;
+            s = next;
+        }
+    }
+
+    Mutex& my_mutex;
+    std::atomic<snapshot*> my_current{nullptr};
+    std::atomic<snapshot*> my_retired{nullptr};
+    std::atomic<std::size_t> my_readers{0};
+}; // class successor_snapshots
+#endif // __TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS
 
 //! An abstract cache of successors
 template<typename T, typename M=spin_rw_mutex >
@@ -265,13 +433,34 @@ protected:
     typedef receiver<T>* pointer_type;
     typedef sender<T> owner_type;
     // TODO revamp: introduce heapified collection of successors for strict priorities
+#if __TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS
+    typedef successor_snapshots< pointer_type, mutex_type > successors_type;
+#else
     typedef std::list< pointer_type > successors_type;
+#endif
     successors_type my_successors;
 
     owner_type* my_owner;
 
+#if __TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS
+    //! Removes r, which rejected a message, if r takes the message by pulling it instead
+    /** Concurrent senders may be rejected by the same successor; only one of them switches it. */
+    void switch_to_pull( successor_type& r ) {
+        typename mutex_type::scoped_lock l(my_mutex, true);
+        if ( my_successors.contains( &r ) && r.register_predecessor( *my_owner ) ) {
+            my_successors.erase( &r );
+        }
+    }
+#endif
+
 public:
-    successor_cache( owner_type* owner ) : my_owner(owner) {
+    successor_cache( owner_type* owner )
+#if __TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS
+        : my_successors(my_mutex), my_owner(owner)
+#else
+        : my_owner(owner)
+#endif
+    {
         // Do not work with the passed pointer here as it may not be fully initialized yet
     }
 
@@ -287,6 +476,9 @@ public:
 
     void remove_successor( successor_type& r ) {
         typename mutex_type::scoped_lock l(my_mutex, true);
+#if __TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS
+        my_successors.erase( &r );
+#else
         for ( typename successors_type::iterator i = my_successors.begin();
               i != my_successors.end(); ++i ) {
             if ( *i == & r ) {
@@ -294,21 +486,58 @@ public:
                 break;
             }
         }
+#endif
     }
 
     bool empty() {
+#if !__TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS
         typename mutex_type::scoped_lock l(my_mutex, false);
+#endif
         return my_successors.empty();
     }
 
     void clear() {
+#if __TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS
+        typename mutex_type::scoped_lock l(my_mutex, true);
+#endif
         my_successors.clear();
     }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    //! Calls f for each successor
+    template <typename F>
+    void for_each_successor( F f ) {
+#if __TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS
+        typename successors_type::reader successors(my_successors);
+#else
+        typename mutex_type::scoped_lock l(my_mutex, false);
+        successors_type& successors = my_successors;
+#endif
+        for ( pointer_type s : successors ) {
+            f(s);
+        }
+    }
+#endif
+
     virtual graph_task* try_put_task( const T& t ) = 0;
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
     virtual graph_task* try_put_task( const T& t, const message_metainfo& metainfo ) = 0;
 #endif
+
+protected:
+    // Put the item to a successor by copy or, for an rvalue, by move
+
+    static graph_task* put_to( successor_type* s, const T& t
+                               __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo) ) {
+        return s->try_put_task(t __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+    }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES
+    static graph_task* put_to( successor_type* s, T&& t
+                               __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo) ) {
+        return s->try_put_task_move(std::move(t) __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+    }
+#endif
 };  // successor_cache<T>
 
 //! An abstract cache of successors, specialized to continue_msg
@@ -322,12 +551,31 @@ protected:
     typedef receiver<continue_msg> successor_type;
     typedef receiver<continue_msg>* pointer_type;
     typedef sender<continue_msg> owner_type;
+#if __TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS
+    typedef successor_snapshots< pointer_type, mutex_type > successors_type;
+#else
     typedef std::list< pointer_type > successors_type;
+#endif
     successors_type my_successors;
     owner_type* my_owner;
 
+#if __TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS
+    void switch_to_pull( successor_type& r ) {
+        typename mutex_type::scoped_lock l(my_mutex, true);
+        if ( my_successors.contains( &r ) && r.register_predecessor( *my_owner ) ) {
+            my_successors.erase( &r );
+        }
+    }
+#endif
+
 public:
-    successor_cache( sender<continue_msg>* owner ) : my_owner(owner) {
+    successor_cache( sender<continue_msg>* owner )
+#if __TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS
+        : my_successors(my_mutex), my_owner(owner)
+#else
+        : my_owner(owner)
+#endif
+    {
         // Do not work with the passed pointer here as it may not be fully initialized yet
     }
 
@@ -347,6 +595,14 @@ public:
 
     void remove_successor( successor_type& r ) {
         typename mutex_type::scoped_lock l(my_mutex, true);
+#if __TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS
+        if ( my_successors.contains( &r ) ) {
+            __TBB_ASSERT(my_owner, "Cache of successors must have an owner.");
+            // TODO: check if we need to test for continue_receiver before removing from r.
+            r.remove_predecessor( *my_owner );
+            my_successors.erase( &r );
+        }
+#else
         for ( successors_type::iterator i = my_successors.begin(); i != my_successors.end(); ++i ) {
             if ( *i == &r ) {
                 __TBB_ASSERT(my_owner, "Cache of successors must have an owner.");
@@ -356,21 +612,50 @@ public:
                 break;
             }
         }
+#endif
     }
 
     bool empty() {
+#if !__TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS
         typename mutex_type::scoped_lock l(my_mutex, false);
+#endif
         return my_successors.empty();
     }
 
     void clear() {
+#if __TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS
+        typename mutex_type::scoped_lock l(my_mutex, true);
+#endif
         my_successors.clear();
     }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    //! Calls f for each successor
+    template <typename F>
+    void for_each_successor( F f ) {
+#if __TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS
+        typename successors_type::reader successors(my_successors);
+#else
+        typename mutex_type::scoped_lock l(my_mutex, false);
+        successors_type& successors = my_successors;
+#endif
+        for ( pointer_type s : successors ) {
+            f(s);
+        }
+    }
+#endif
+
     virtual graph_task* try_put_task( const continue_msg& t ) = 0;
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
     virtual graph_task* try_put_task( const continue_msg& t, const message_metainfo& metainfo ) = 0;
 #endif
+
+protected:
+    // continue_msg has no state to move
+    static graph_task* put_to( successor_type* s, const continue_msg& t
+                               __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo) ) {
+        return s->try_put_task(t __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+    }
 };  // successor_cache< continue_msg >
 
 //! A cache of successors that are broadcast to
@@ -380,12 +665,55 @@ class broadcast_cache : public successor_cache<T, M> {
     typedef M mutex_type;
     typedef typename successor_cache<T,M>::successors_type successors_type;
 
-    graph_task* try_put_task_impl( const T& t __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo) ) {
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+    //! The only successor, which is executed inline; nullptr if the successors are not fused
+    std::atomic<receiver<T>*> my_fused_successor{nullptr};
+#endif
+
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    node_statistics* my_statistics{nullptr};
+#endif
+
+    //! Counts a message accepted by at least one successor
+    graph_task* record_output( graph_task* task ) {
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        if ( task && my_statistics ) {
+            my_statistics->record_output();
+        }
+#endif
+        return task;
+    }
+
+    //! Puts a copy of the item to each successor; an rvalue item is moved to the last successor
+    template <typename Item>
+    graph_task* try_put_task_impl( Item&& t __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo) ) {
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+        if ( receiver<T>* fused = my_fused_successor.load(std::memory_order_acquire) ) {
+            return record_output(fused->try_put_task_fused(t __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo)));
+        }
+#endif
         graph_task * last_task = nullptr;
+#if __TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS
+        typename successors_type::reader successors(this->my_successors);
+        for ( receiver<T>* const* i = successors.begin(); i != successors.end(); ++i ) {
+            receiver<T>* s = *i;
+            graph_task *new_task = i + 1 == successors.end()
+                ? this->put_to(s, std::forward<Item>(t) __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo))
+                : s->try_put_task(t __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+            graph& graph_ref = s->graph_reference();
+            last_task = combine_tasks(graph_ref, last_task, new_task);  // enqueue if necessary
+            if ( !new_task ) {
+                this->switch_to_pull(*s);
+            }
+        }
+        return record_output(last_task);
+#else
         typename mutex_type::scoped_lock l(this->my_mutex, /*write=*/true);
         typename successors_type::iterator i = this->my_successors.begin();
         while ( i != this->my_successors.end() ) {
-            graph_task *new_task = (*i)->try_put_task(t __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+            graph_task *new_task = std::next(i) == this->my_successors.end()
+                ? this->put_to(*i, std::forward<Item>(t) __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo))
+                : (*i)->try_put_task(t __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
             // workaround for icc bug
             graph& graph_ref = (*i)->graph_reference();
             last_task = combine_tasks(graph_ref, last_task, new_task);  // enqueue if necessary
@@ -400,7 +728,8 @@ class broadcast_cache : public successor_cache<T, M> {
                 }
             }
         }
-        return last_task;
+        return record_output(last_task);
+#endif
     }
 public:
 
@@ -408,6 +737,57 @@ public:
         // Do not work with the passed pointer here as it may not be fully initialized yet
     }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    //! Counts the messages accepted by the successors in the statistics of the owner
+    void set_statistics( node_statistics* s ) { my_statistics = s; }
+#endif
+
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+    // Any change of the successors stops the fusion until it is requested again
+
+    void register_successor( typename base_type::successor_type& r ) {
+        my_fused_successor.store(nullptr, std::memory_order_relaxed);
+        base_type::register_successor(r);
+    }
+
+    void remove_successor( typename base_type::successor_type& r ) {
+        my_fused_successor.store(nullptr, std::memory_order_relaxed);
+        base_type::remove_successor(r);
+    }
+
+    void clear() {
+        my_fused_successor.store(nullptr, std::memory_order_relaxed);
+        base_type::clear();
+    }
+
+    //! Returns the only successor if it may be executed inline, or nullptr otherwise
+    receiver<T>* fusible_successor() {
+        typename mutex_type::scoped_lock l(this->my_mutex, /*write=*/false);
+        return fusible_successor_impl();
+    }
+
+    //! Starts executing the only successor inline if it is fusible, or stops doing that
+    void set_fused( bool fused ) {
+        typename mutex_type::scoped_lock l(this->my_mutex, /*write=*/true);
+        my_fused_successor.store(fused ? fusible_successor_impl() : nullptr, std::memory_order_release);
+    }
+
+private:
+    receiver<T>* fusible_successor_impl() {
+#if __TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS
+        typename successors_type::reader successors(this->my_successors);
+#else
+        successors_type& successors = this->my_successors;
+#endif
+        if ( successors.size() == 1 && (*successors.begin())->is_fusible() ) {
+            return *successors.begin();
+        }
+        return nullptr;
+    }
+
+public:
+#endif
+
     graph_task* try_put_task( const T &t ) override {
         return try_put_task_impl(t __TBB_FLOW_GRAPH_METAINFO_ARG(message_metainfo{}));
     }
@@ -418,9 +798,35 @@ public:
     }
 #endif
 
+#if __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES
+    graph_task* try_put_task_move( T&& t ) {
+        return try_put_task_impl(std::move(t) __TBB_FLOW_GRAPH_METAINFO_ARG(message_metainfo{}));
+    }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+    graph_task* try_put_task_move( T&& t, const message_metainfo& metainfo ) {
+        return try_put_task_impl(std::move(t), metainfo);
+    }
+#endif
+#endif
+
     // call try_put_task and return list of received tasks
     bool gather_successful_try_puts( const T &t, graph_task_list& tasks ) {
         bool is_at_least_one_put_successful = false;
+#if __TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS
+        typename successors_type::reader successors(this->my_successors);
+        for ( receiver<T>* s : successors ) {
+            graph_task * new_task = s->try_put_task(t);
+            if ( new_task ) {
+                if ( new_task != SUCCESSFULLY_ENQUEUED ) {
+                    tasks.push_back(*new_task);
+                }
+                is_at_least_one_put_successful = true;
+            } else {
+                this->switch_to_pull(*s);
+            }
+        }
+#else
         typename mutex_type::scoped_lock l(this->my_mutex, /*write=*/true);
         typename successors_type::iterator i = this->my_successors.begin();
         while ( i != this->my_successors.end() ) {
@@ -440,6 +846,12 @@ public:
                 }
             }
         }
+#endif
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        if ( is_at_least_one_put_successful && my_statistics ) {
+            my_statistics->record_output();
+        }
+#endif
         return is_at_least_one_put_successful;
     }
 };
@@ -458,22 +870,54 @@ public:
         // Do not work with the passed pointer here as it may not be fully initialized yet
     }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    //! Counts the messages accepted by the successors in the statistics of the owner
+    void set_statistics( node_statistics* s ) { my_statistics = s; }
+#endif
+
     size_type size() {
+#if !__TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS
         typename mutex_type::scoped_lock l(this->my_mutex, false);
+#endif
         return this->my_successors.size();
     }
 
 private:
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    node_statistics* my_statistics{nullptr};
+#endif
+
+    graph_task* record_output( graph_task* task ) {
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        if ( my_statistics ) {
+            my_statistics->record_output();
+        }
+#endif
+        return task;
+    }
 
-    graph_task* try_put_task_impl( const T &t
+    //! Puts the item to the first successor that accepts it; an rvalue item is moved to that successor
+    template <typename Item>
+    graph_task* try_put_task_impl( Item&& t
                                    __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo) )
     {
+#if __TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS
+        typename successors_type::reader successors(this->my_successors);
+        for ( receiver<T>* s : successors ) {
+            // A successor that rejects the item does not move from it
+            graph_task* new_task = this->put_to(s, std::forward<Item>(t) __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+            if ( new_task ) {
+                return record_output(new_task);
+            }
+            this->switch_to_pull(*s);
+        }
+#else
         typename mutex_type::scoped_lock l(this->my_mutex, /*write=*/true);
         typename successors_type::iterator i = this->my_successors.begin();
         while ( i != this->my_successors.end() ) {
-            graph_task* new_task = (*i)->try_put_task(t __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+            graph_task* new_task = this->put_to(*i, std::forward<Item>(t) __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
             if ( new_task ) {
-                return new_task;
+                return record_output(new_task);
             } else {
                if ( (*i)->register_predecessor(*this->my_owner) ) {
                    i = this->my_successors.erase(i);
@@ -483,6 +927,7 @@ private:
                }
             }
         }
+#endif
         return nullptr;
     }
 
@@ -496,6 +941,18 @@ public:
         return try_put_task_impl(t, metainfo);
     }
 #endif
+
+#if __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES
+    graph_task* try_put_task_move( T&& t ) {
+        return try_put_task_impl(std::move(t) __TBB_FLOW_GRAPH_METAINFO_ARG(message_metainfo{}));
+    }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+    graph_task* try_put_task_move( T&& t, const message_metainfo& metainfo ) {
+        return try_put_task_impl(std::move(t), metainfo);
+    }
+#endif
+#endif
 };
 
 #endif // __TBB__flow_graph_cache_impl_H
@@ -132,6 +132,10 @@ public:
     graph& my_graph; // graph instance the task belongs to
     // TODO revamp: rename to my_priority
     node_priority_t priority;
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_ARENAS
+    //! Set by node_arena_binding::bind_task
+    task_arena* my_arena{ nullptr };
+#endif
     template <typename DerivedType>
     void destruct_and_deallocate(const d1::execution_data& ed);
 protected:
@@ -147,6 +151,31 @@ private:
     friend graph_task* prioritize_task(graph& g, graph_task& gt);
 };
 
+//! The arena set by bind_to_arena for the tasks of a node; nullptr stands for the arena of the graph
+class node_arena_binding {
+protected:
+    //! The body of a bound node is never executed by the thread that puts the message
+    bool is_bound_to_arena() const {
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_ARENAS
+        return my_arena != nullptr;
+#else
+        return false;
+#endif
+    }
+
+    void bind_task(graph_task& t) const {
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_ARENAS
+        t.my_arena = my_arena;
+#else
+        suppress_unused_warning(t);
+#endif
+    }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_ARENAS
+    task_arena* my_arena{nullptr};
+#endif
+};
+
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
 class trackable_messages_graph_task : public graph_task {
 public:
@@ -414,6 +443,9 @@ private:
     friend void activate_graph(graph& g);
     friend void deactivate_graph(graph& g);
     friend bool is_graph_active(graph& g);
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+    friend bool is_graph_cancelled(graph& g);
+#endif
     friend graph_task* prioritize_task(graph& g, graph_task& arena_task);
     friend void spawn_in_graph_arena(graph& g, graph_task& arena_task);
     friend void enqueue_in_graph_arena(graph &g, graph_task& arena_task);
@@ -461,6 +493,19 @@ inline graph_task::graph_task(graph& g, d1::small_object_allocator& allocator,
 class get_graph_helper;
 #endif
 
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+//! The edge from a node to the only successor that the node may execute inline
+/** The ends are identified by the addresses of the receivers. */
+struct fusion_link {
+    const void* input = nullptr;
+    const void* successor = nullptr;
+};
+#endif
+
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+struct node_description;
+#endif
+
 //! The base of all graph nodes.
 class graph_node : no_copy {
     friend class graph;
@@ -487,8 +532,49 @@ public:
 protected:
     // performs the reset on an individual node.
     virtual void reset_node(reset_flags f = rf_reset_protocol) = 0;
+
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+    friend std::size_t fuse_serial_chains(graph& g);
+
+    //! Returns the edge to the successor that the node may execute inline, if any
+    virtual fusion_link fusion_candidate() { return fusion_link{}; }
+
+    //! Starts or stops executing the only successor inline
+    virtual void set_fused(bool) {}
+#endif
+
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    friend std::string graph_to_dot(graph& g);
+    friend void record_node_name(const graph_node& n, const char* name);
+
+    //! The name given by set_name
+    std::string my_name;
+
+    //! Adds the ports, edges and statistics of the node; the nodes that do not are not shown
+    virtual void describe(node_description&) {}
+#endif
+
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_ARENAS
+    friend void set_node_arena(graph_node& n, task_arena* a);
+
+    //! Makes the arena execute the body of the node; the nodes without a body ignore it
+    virtual void set_task_arena(task_arena*) {}
+#endif
 };  // class graph_node
 
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_ARENAS
+inline void set_node_arena(graph_node& n, task_arena* a) {
+    n.set_task_arena(a);
+}
+#endif
+
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+inline void record_node_name(const graph_node& n, const char* name) {
+    // set_name takes the node by a const reference
+    const_cast<graph_node&>(n).my_name = name ? name : "";
+}
+#endif
+
 inline void activate_graph(graph& g) {
     g.my_is_active = true;
 }
@@ -501,7 +587,23 @@ inline bool is_graph_active(graph& g) {
     return g.my_is_active;
 }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+inline bool is_graph_cancelled(graph& g) {
+    return g.my_context->is_group_execution_cancelled();
+}
+#endif
+
 inline graph_task* prioritize_task(graph& g, graph_task& gt) {
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_ARENAS
+    if( gt.my_arena ) {
+        // The task bound to an arena is submitted there rather than executed by the current thread.
+        // The priority queue of the graph is served in the arena of the graph, so the task with
+        // a priority is submitted as a critical task instead.
+        using tbb::detail::d1::submit;
+        submit( gt, *gt.my_arena, *g.my_context, /*as_critical=*/gt.priority != no_priority );
+        return nullptr;
+    }
+#endif
     if( no_priority == gt.priority )
         return &gt;
 
@@ -536,6 +638,22 @@ inline void spawn_in_graph_arena(graph& g, graph_task& arena_task) {
     }
 }
 
+//! Prepares the task returned by the current task for bypass
+inline graph_task* prioritize_next_task(graph& g, const graph_task& current, graph_task& next) {
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_ARENAS
+    // The current task runs in its own arena, so only the next task of the same arena is bypassed
+    if( next.my_arena != current.my_arena && !next.my_arena ) {
+        spawn_in_graph_arena(g, next);
+        return nullptr;
+    }
+    if( next.my_arena && next.my_arena == current.my_arena && next.priority == no_priority )
+        return &next;
+#else
+    suppress_unused_warning(current);
+#endif
+    return prioritize_task(g, next);
+}
+
 // TODO revamp: unify *_in_graph_arena functions
 
 //! Enqueues a task inside graph arena
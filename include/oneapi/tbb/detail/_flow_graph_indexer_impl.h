@@ -218,6 +218,14 @@
             }
         }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        void describe(node_description& d) override {
+            d.type = FLOW_INDEXER_NODE;
+            statistics_ports<std::tuple_size<InputTuple>::value>::add_inputs(d, this->input_ports());
+            d.add_output(my_successors);
+        }
+#endif
+
     private:
         broadcast_cache<output_type, null_rw_mutex> my_successors;
     };  //indexer_node_base
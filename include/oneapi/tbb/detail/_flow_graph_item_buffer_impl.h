@@ -91,14 +91,28 @@ protected:
     }
 #endif
 
+    item_type &get_my_item(size_t i) {
+        __TBB_ASSERT(my_item_valid(i),"attempt to get invalid item");
+        return element(i).item;
+    }
+
+    typedef typename std::conditional<std::is_copy_constructible<item_type>::value,
+                                      const item_type&, item_type&&>::type copy_source_type;
+
+    //! Returns the item to construct a copy from
+    /** The items of move-only types are only put as rvalues, so they are moved instead. **/
+    static copy_source_type copy_source(item_type& o) { return static_cast<copy_source_type>(o); }
+
     // may be called with an empty slot or a slot that has already been constructed into.
-    void set_my_item(size_t i, const item_type &o
+    // The item is copied or, if passed as an rvalue, moved.
+    template <typename Item>
+    void set_my_item(size_t i, Item&& o
                      __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo))
     {
         if(element(i).state != no_item) {
             destroy_item(i);
         }
-        new(&(element(i).item)) item_type(o);
+        new(&(element(i).item)) item_type(std::forward<Item>(o));
         element(i).state = has_item;
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
         new(&element(i).metainfo) message_metainfo(metainfo);
@@ -110,12 +124,13 @@ protected:
     }
 
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
-    void set_my_item(size_t i, const item_type& o, message_metainfo&& metainfo) {
+    template <typename Item>
+    void set_my_item(size_t i, Item&& o, message_metainfo&& metainfo) {
         if(element(i).state != no_item) {
             destroy_item(i);
         }
 
-        new(&(element(i).item)) item_type(o);
+        new(&(element(i).item)) item_type(std::forward<Item>(o));
         new(&element(i).metainfo) message_metainfo(std::move(metainfo));
         // Skipping the reservation on metainfo.waiters since the ownership
         // is moving from metainfo to the cache
@@ -127,14 +142,14 @@ protected:
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
     void fetch_item(size_t i, item_type& o, message_metainfo& metainfo) {
         __TBB_ASSERT(my_item_valid(i), "Trying to fetch an empty slot");
-        o = get_my_item(i);  // could have std::move assign semantics
+        o = std::move(get_my_item(i));
         metainfo = std::move(get_my_metainfo(i));
         destroy_item(i);
     }
 #else
     void fetch_item(size_t i, item_type &o) {
         __TBB_ASSERT(my_item_valid(i), "Trying to fetch an empty slot");
-        o = get_my_item(i);  // could have std::move assign semantics
+        o = std::move(get_my_item(i));
         destroy_item(i);
     }
 #endif
@@ -145,42 +160,43 @@ protected:
     void move_item(size_t to, size_t from) {
         __TBB_ASSERT(!my_item_valid(to), "Trying to move to a non-empty slot");
         __TBB_ASSERT(my_item_valid(from), "Trying to move from an empty slot");
-        // could have std::move semantics
-        set_my_item(to, get_my_item(from) __TBB_FLOW_GRAPH_METAINFO_ARG(get_my_metainfo(from)));
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+        set_my_item(to, std::move(get_my_item(from)), std::move(get_my_metainfo(from)));
+        // The waiters were not reserved again for the moved-to slot
+        element(from).metainfo = message_metainfo{};
+#else
+        set_my_item(to, std::move(get_my_item(from)));
+#endif
         destroy_item(from);
     }
 
     // put an item in an empty slot.  Return true if successful, else false
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
-    template <typename Metainfo>
-    bool place_item(size_t here, const item_type &me, Metainfo&& metainfo) {
+    template <typename Item, typename Metainfo>
+    bool place_item(size_t here, Item&& me, Metainfo&& metainfo) {
 #if !TBB_DEPRECATED_SEQUENCER_DUPLICATES
         if(my_item_valid(here)) return false;
 #endif
-        set_my_item(here, me, std::forward<Metainfo>(metainfo));
+        set_my_item(here, std::forward<Item>(me), std::forward<Metainfo>(metainfo));
         return true;
     }
 #else
-    bool place_item(size_t here, const item_type &me) {
+    template <typename Item>
+    bool place_item(size_t here, Item&& me) {
 #if !TBB_DEPRECATED_SEQUENCER_DUPLICATES
         if(my_item_valid(here)) return false;
 #endif
-        set_my_item(here, me);
+        set_my_item(here, std::forward<Item>(me));
         return true;
     }
 #endif
 
-    // could be implemented with std::move semantics
     void swap_items(size_t i, size_t j) {
         __TBB_ASSERT(my_item_valid(i) && my_item_valid(j), "attempt to swap invalid item(s)");
-        item_type temp = get_my_item(i);
+        using std::swap;
+        swap(get_my_item(i), get_my_item(j));
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
-        message_metainfo temp_metainfo = get_my_metainfo(i);
-        set_my_item(i, get_my_item(j), get_my_metainfo(j));
-        set_my_item(j, temp, temp_metainfo);
-#else
-        set_my_item(i, get_my_item(j));
-        set_my_item(j, temp);
+        swap(get_my_metainfo(i), get_my_metainfo(j));
 #endif
     }
 
@@ -207,6 +223,12 @@ protected:
         return get_my_item(my_head);
     }
 
+    item_type& front()
+    {
+        __TBB_ASSERT(my_item_valid(my_head), "attempt to fetch head non-item");
+        return get_my_item(my_head);
+    }
+
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
     const message_metainfo& front_metainfo() const
     {
@@ -222,6 +244,12 @@ protected:
         return get_my_item(my_tail - 1);
     }
 
+    item_type& back()
+    {
+        __TBB_ASSERT(my_item_valid(my_tail - 1), "attempt to fetch head non-item");
+        return get_my_item(my_tail - 1);
+    }
+
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
     const message_metainfo& back_metainfo() const {
         __TBB_ASSERT(my_item_valid(my_tail - 1), "attempt to fetch head non-item");
@@ -266,9 +294,8 @@ protected:
 
         for( size_type i=my_head; i<my_tail; ++i) {
             if(my_item_valid(i)) {  // sequencer_node may have empty slots
-                // placement-new copy-construct; could be std::move
                 char *new_space = (char *)&(new_array[i&(new_size-1)].begin()->item);
-                (void)new(new_space) item_type(get_my_item(i));
+                (void)new(new_space) item_type(std::move(get_my_item(i)));
                 new_array[i&(new_size-1)].begin()->state = element(i).state;
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
                 char* meta_space = (char *)&(new_array[i&(new_size-1)].begin()->metainfo);
@@ -283,13 +310,14 @@ protected:
         my_array_size = new_size;
     }
 
-    bool push_back(item_type& v
+    template <typename Item>
+    bool push_back(Item&& v
                    __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo))
     {
         if (buffer_full()) {
             grow_my_array(size() + 1);
         }
-        set_my_item(my_tail, v __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+        set_my_item(my_tail, std::forward<Item>(v) __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
         ++my_tail;
         return true;
     }
@@ -301,7 +329,7 @@ protected:
             return false;
         }
         auto& e = element(my_tail - 1);
-        v = e.item;
+        v = std::move(e.item);
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
         metainfo = std::move(e.metainfo);
 #endif
@@ -317,7 +345,7 @@ protected:
             return false;
         }
         auto& e = element(my_head);
-        v = e.item;
+        v = std::move(e.item);
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
         metainfo = std::move(e.metainfo);
 #endif
@@ -385,9 +413,9 @@ protected:
 
     bool reserve_front(T &v) {
         if(my_reserved || !my_item_valid(this->my_head)) return false;
-        my_reserved = true;
         // reserving the head
-        v = this->front();
+        if(!copy_item(v, this->front(), std::is_copy_assignable<T>())) return false;
+        my_reserved = true;
         this->reserve_item(this->my_head);
         return true;
     }
@@ -395,9 +423,9 @@ protected:
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
     bool reserve_front(T& v, message_metainfo& metainfo) {
         if (my_reserved || !my_item_valid(this->my_head)) return false;
-        my_reserved = true;
         // reserving the head
-        v = this->front();
+        if (!copy_item(v, this->front(), std::is_copy_assignable<T>())) return false;
+        my_reserved = true;
         metainfo = this->front_metainfo();
         this->reserve_item(this->my_head);
         return true;
@@ -416,6 +444,10 @@ protected:
         my_reserved = false;
     }
 
+    //! The reserved item stays in the buffer, so the items of move-only types cannot be reserved
+    static bool copy_item(T& to, const T& from, /*copyable=*/std::true_type) { to = from; return true; }
+    static bool copy_item(T&, const T&, /*copyable=*/std::false_type) { return false; }
+
     bool my_reserved;
 };
 
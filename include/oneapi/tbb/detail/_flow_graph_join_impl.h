@@ -470,15 +470,18 @@
         class queueing_port_operation : public d1::aggregated_operation<queueing_port_operation> {
         public:
             char type;
-            T my_val;
             T* my_arg;
             graph_task* bypass_t;
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
             message_metainfo* metainfo;
 #endif
-            // constructor for value parameter
+#if __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES
+            //! The value was put as an rvalue and may be moved from
+            bool move_arg{false};
+#endif
+            // constructor for value parameter; the value is copied into the buffer by the handler
             queueing_port_operation(const T& e, op_type t __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& info))
-                : type(char(t)), my_val(e), my_arg(nullptr)
+                : type(char(t)), my_arg(const_cast<T*>(&e))
                 , bypass_t(nullptr)
                 __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo(const_cast<message_metainfo*>(&info)))
             {}
@@ -516,10 +519,17 @@
                         was_empty = this->buffer_empty();
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
                         __TBB_ASSERT(current->metainfo, nullptr);
-                        this->push_back(current->my_val, *(current->metainfo));
-#else
-                        this->push_back(current->my_val);
 #endif
+#if __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES
+                        if (current->move_arg) {
+                            this->push_back(std::move(*(current->my_arg))
+                                            __TBB_FLOW_GRAPH_METAINFO_ARG(*(current->metainfo)));
+                        } else
+#endif
+                        {
+                            this->push_back(this->copy_source(*(current->my_arg))
+                                            __TBB_FLOW_GRAPH_METAINFO_ARG(*(current->metainfo)));
+                        }
                         if (was_empty) rtask = my_join->decrement_port_count(false);
                         else
                             rtask = SUCCESSFULLY_ENQUEUED;
@@ -561,8 +571,14 @@
         template<typename X, typename Y> friend class round_robin_cache;
 
     private:
-        graph_task* try_put_task_impl(const T& v __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo)) {
+        graph_task* try_put_task_impl(const T& v __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo),
+                                      bool move_arg = false) {
             queueing_port_operation op_data(v, try__put_task __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+#if __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES
+            op_data.move_arg = move_arg;
+#else
+            suppress_unused_warning(move_arg);
+#endif
             my_aggregator.execute(&op_data);
             __TBB_ASSERT(op_data.status == SUCCEEDED || !op_data.bypass_t, "inconsistent return from aggregator");
             if(!op_data.bypass_t) return SUCCESSFULLY_ENQUEUED;
@@ -570,16 +586,30 @@
         }
 
     protected:
+        //! The items of move-only types are rejected unless they are put as rvalues
         graph_task* try_put_task(const T &v) override {
-            return try_put_task_impl(v __TBB_FLOW_GRAPH_METAINFO_ARG(message_metainfo{}));
+            return std::is_copy_constructible<T>::value
+                ? try_put_task_impl(v __TBB_FLOW_GRAPH_METAINFO_ARG(message_metainfo{})) : nullptr;
         }
 
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
         graph_task* try_put_task(const T& v, const message_metainfo& metainfo) override {
-            return try_put_task_impl(v, metainfo);
+            return std::is_copy_constructible<T>::value ? try_put_task_impl(v, metainfo) : nullptr;
         }
 #endif
 
+#if __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES
+        graph_task* try_put_task_move(T&& v) override {
+            return try_put_task_impl(v __TBB_FLOW_GRAPH_METAINFO_ARG(message_metainfo{}), /*move_arg=*/true);
+        }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+        graph_task* try_put_task_move(T&& v, const message_metainfo& metainfo) override {
+            return try_put_task_impl(v, metainfo, /*move_arg=*/true);
+        }
+#endif
+#endif
+
         graph& graph_reference() const override {
             return my_join->graph_ref;
         }
@@ -1443,7 +1473,22 @@
             if(f & rf_clear_edges) my_successors.clear();
         }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        void describe(node_description& d) override {
+            d.type = join_type(static_cast<JP*>(nullptr));
+            statistics_ports<std::tuple_size<InputTuple>::value>::add_inputs(d, this->input_ports());
+            d.add_output(my_successors);
+        }
+#endif
+
     private:
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        static string_resource_index join_type(reserving*) { return FLOW_JOIN_NODE_RESERVING; }
+        static string_resource_index join_type(queueing*) { return FLOW_JOIN_NODE_QUEUEING; }
+        template<typename K, typename KHash>
+        static string_resource_index join_type(key_matching<K, KHash>*) { return FLOW_JOIN_NODE_TAG_MATCHING; }
+#endif
+
         broadcast_cache<output_type, null_rw_mutex> my_successors;
 
         friend class forward_task_bypass< join_node_base<JP, InputTuple, OutputTuple> >;
@@ -34,6 +34,10 @@ public:
         return this->item_buffer<T, A>::front();
     }
 
+    T& front() {
+        return this->item_buffer<T, A>::front();
+    }
+
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
     const message_metainfo& front_metainfo() const {
         return this->item_buffer<T,A>::front_metainfo();
@@ -44,13 +48,21 @@ public:
         this->destroy_front();
     }
 
-    bool push( T& t ) {
-        return this->push_back( t );
+    template <typename Item>
+    bool push( Item&& t ) {
+        return this->push_back( std::forward<Item>(t) );
     }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    std::size_t size() const {
+        return this->my_tail - this->my_head;
+    }
+#endif
+
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
-    bool push( T& t, const message_metainfo& metainfo ) {
-        return this->push_back(t, metainfo);
+    template <typename Item>
+    bool push( Item&& t, const message_metainfo& metainfo ) {
+        return this->push_back(std::forward<Item>(t), metainfo);
     }
 #endif
 };
@@ -59,7 +71,7 @@ public:
 //  The only up-ref is apply_body_impl, which should implement the function
 //  call and any handling of the result.
 template< typename Input, typename Policy, typename A, typename ImplType >
-class function_input_base : public receiver<Input>, no_assign {
+class function_input_base : public receiver<Input>, public node_arena_binding, no_assign {
     enum op_type {reg_pred, rem_pred, try_fwd, tryput_bypass, app_body_bypass, occupy_concurrency
     };
     typedef function_input_base<Input, Policy, A, ImplType> class_type;
@@ -80,6 +92,9 @@ public:
         , my_concurrency(0), my_priority(a_priority), my_is_no_throw(is_no_throw)
         , my_queue(!has_policy<rejecting, Policy>::value ? new input_queue_type() : nullptr)
         , my_predecessors(this)
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        , my_statistics(max_concurrency)
+#endif
         , forwarder_busy(false)
     {
         my_aggregator.initialize_handler(handler_type(this));
@@ -108,6 +123,38 @@ public:
     }
 #endif // __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
 
+#if __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES
+    //! The item is moved into the queue or into the body task; the body still receives it by const reference
+    graph_task* try_put_task_move( input_type&& t ) override {
+        return try_put_task_base(std::move(t) __TBB_FLOW_GRAPH_METAINFO_ARG(message_metainfo{}));
+    }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+    graph_task* try_put_task_move( input_type&& t, const message_metainfo& metainfo ) override {
+        return try_put_task_base(std::move(t), metainfo);
+    }
+#endif
+#endif // __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES
+
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+    //! A rejecting node may drop the item, and a node with priority must go through the scheduler
+    /** A throwing body would leave its concurrency slot occupied, as for a lightweight node. */
+    bool is_fusible() override {
+        return !has_policy<rejecting, Policy>::value && my_priority == no_priority
+            && my_is_no_throw && !is_bound_to_arena();
+    }
+
+    graph_task* try_put_task_fused( const input_type& t ) override {
+        return try_put_task_fused_impl(t __TBB_FLOW_GRAPH_METAINFO_ARG(message_metainfo{}));
+    }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+    graph_task* try_put_task_fused( const input_type& t, const message_metainfo& metainfo ) override {
+        return try_put_task_fused_impl(t, metainfo);
+    }
+#endif
+#endif // __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+
     //! Adds src to the list of cached predecessors.
     bool register_predecessor( predecessor_type &src ) override {
         operation_type op_data(reg_pred);
@@ -124,6 +171,11 @@ public:
         return true;
     }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    node_statistics& statistics() { return my_statistics; }
+    const node_statistics& statistics() const { return my_statistics; }
+#endif
+
 protected:
 
     void reset_function_input_base( reset_flags f) {
@@ -142,6 +194,9 @@ protected:
     const bool my_is_no_throw;
     input_queue_type *my_queue;
     predecessor_cache<input_type, null_mutex > my_predecessors;
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    node_statistics my_statistics;
+#endif
 
     void reset_receiver( reset_flags f) {
         if( f & rf_clear_edges) my_predecessors.clear();
@@ -179,6 +234,8 @@ private:
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
         message_metainfo* metainfo;
 #endif
+        //! The item was put as an rvalue and may be moved from
+        bool move_elem{false};
         operation_type(const input_type& e, op_type t) :
             type(char(t)), elem(const_cast<input_type*>(&e)), bypass_t(nullptr)
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
@@ -205,7 +262,7 @@ private:
                 ++my_concurrency;
                 // TODO: consider removing metainfo from the queue using move semantics to avoid
                 // ref counter increase
-                new_task = create_body_task(my_queue->front()
+                new_task = create_body_task(std::move(my_queue->front())
                                             __TBB_FLOW_GRAPH_METAINFO_ARG(my_queue->front_metainfo()));
 
                 my_queue->pop();
@@ -218,7 +275,10 @@ private:
 #endif
             if(my_predecessors.get_item(i __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo))) {
                 ++my_concurrency;
-                new_task = create_body_task(i __TBB_FLOW_GRAPH_METAINFO_ARG(std::move(metainfo)));
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+                my_statistics.record_put(true);
+#endif
+                new_task = create_body_task(std::move(i) __TBB_FLOW_GRAPH_METAINFO_ARG(std::move(metainfo)));
             }
         }
         return new_task;
@@ -269,13 +329,18 @@ private:
         __TBB_ASSERT(my_max_concurrency != 0, nullptr);
         if (my_concurrency < my_max_concurrency) {
             ++my_concurrency;
-            graph_task* new_task = create_body_task(*(op->elem)
-                                                    __TBB_FLOW_GRAPH_METAINFO_ARG(*(op->metainfo)));
+            graph_task* new_task = op->move_elem
+                ? create_body_task(std::move(*(op->elem)) __TBB_FLOW_GRAPH_METAINFO_ARG(*(op->metainfo)))
+                : create_body_task(*(op->elem) __TBB_FLOW_GRAPH_METAINFO_ARG(*(op->metainfo)));
             op->bypass_t = new_task;
             op->status.store(SUCCEEDED, std::memory_order_release);
-        } else if ( my_queue && my_queue->push(*(op->elem)
-                    __TBB_FLOW_GRAPH_METAINFO_ARG(*(op->metainfo))) )
+        } else if ( my_queue && (op->move_elem
+                    ? my_queue->push(std::move(*(op->elem)) __TBB_FLOW_GRAPH_METAINFO_ARG(*(op->metainfo)))
+                    : my_queue->push(*(op->elem) __TBB_FLOW_GRAPH_METAINFO_ARG(*(op->metainfo)))) )
         {
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+            my_statistics.record_queue_size(my_queue->size());
+#endif
             op->bypass_t = SUCCESSFULLY_ENQUEUED;
             op->status.store(SUCCEEDED, std::memory_order_release);
         } else {
@@ -297,10 +362,13 @@ private:
         }
     }
 
-    graph_task* internal_try_put_bypass( const input_type& t
+    // The item is moved from only if it is passed as an rvalue and accepted
+    template <typename In>
+    graph_task* internal_try_put_bypass( In&& t
                                          __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo))
     {
         operation_type op_data(t, tryput_bypass __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+        op_data.move_elem = !std::is_lvalue_reference<In>::value;
         my_aggregator.execute(&op_data);
         if( op_data.status == SUCCEEDED ) {
             return op_data.bypass_t;
@@ -308,18 +376,25 @@ private:
         return nullptr;
     }
 
-    graph_task* try_put_task_base(const input_type& t
+    template <typename In>
+    graph_task* try_put_task_base(In&& t
                                   __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo))
     {
-        if ( my_is_no_throw )
-            return try_put_task_impl(t, has_policy<lightweight, Policy>()
-                                     __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+        graph_task* res = nullptr;
+        if ( my_is_no_throw && !is_bound_to_arena() )
+            res = try_put_task_impl(std::forward<In>(t), has_policy<lightweight, Policy>()
+                                    __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
         else
-            return try_put_task_impl(t, std::false_type()
-                                     __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+            res = try_put_task_impl(std::forward<In>(t), std::false_type()
+                                    __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        my_statistics.record_put(res != nullptr);
+#endif
+        return res;
     }
 
-    graph_task* try_put_task_impl( const input_type& t, /*lightweight=*/std::true_type
+    template <typename In>
+    graph_task* try_put_task_impl( In&& t, /*lightweight=*/std::true_type
                                    __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo))
     {
         if( my_max_concurrency == 0 ) {
@@ -330,17 +405,39 @@ private:
             if( check_op.status == SUCCEEDED ) {
                 return apply_body_bypass(t __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
             }
-            return internal_try_put_bypass(t __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+            return internal_try_put_bypass(std::forward<In>(t) __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+        }
+    }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+    //! Executes the no-throw body inline as for a lightweight node, within the concurrency limit
+    graph_task* try_put_task_fused_impl( const input_type& t
+                                         __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo))
+    {
+        if ( !my_is_no_throw || is_graph_cancelled(my_graph_ref) || is_bound_to_arena() ) {
+            // A task is created as if the predecessor had not been fused; the cancelled graph skips it
+            graph_task* res = try_put_task_impl(t, std::false_type() __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+            my_statistics.record_put(res != nullptr);
+#endif
+            return res;
         }
+        graph_task* res = try_put_task_impl(t, std::true_type() __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        my_statistics.record_put(true);
+#endif
+        return res ? res : SUCCESSFULLY_ENQUEUED;
     }
+#endif
 
-    graph_task* try_put_task_impl( const input_type& t, /*lightweight=*/std::false_type
+    template <typename In>
+    graph_task* try_put_task_impl( In&& t, /*lightweight=*/std::false_type
                                    __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo))
     {
         if( my_max_concurrency == 0 ) {
-            return create_body_task(t __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+            return create_body_task(std::forward<In>(t) __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
         } else {
-            return internal_try_put_bypass(t __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+            return internal_try_put_bypass(std::forward<In>(t) __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
         }
     }
 
@@ -353,12 +450,13 @@ private:
         return static_cast<ImplType *>(this)->apply_body_impl_bypass(i __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
     }
 
-    //! allocates a task to apply a body
+    //! allocates a task to apply a body; the input passed as an rvalue is moved into the task
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
-    template <typename Metainfo>
-    graph_task* create_body_task( const input_type &input, Metainfo&& metainfo )
+    template <typename In, typename Metainfo>
+    graph_task* create_body_task( In&& input, Metainfo&& metainfo )
 #else
-    graph_task* create_body_task( const input_type &input )
+    template <typename In>
+    graph_task* create_body_task( In&& input )
 #endif
     {
         if (!is_graph_active(my_graph_ref)) {
@@ -370,13 +468,14 @@ private:
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
         if (!metainfo.empty()) {
             using task_type = apply_body_task_bypass<class_type, input_type, trackable_messages_graph_task>;
-            t = allocator.new_object<task_type>(my_graph_ref, allocator, *this, input, my_priority, std::forward<Metainfo>(metainfo));
+            t = allocator.new_object<task_type>(my_graph_ref, allocator, *this, std::forward<In>(input), my_priority, std::forward<Metainfo>(metainfo));
         } else
 #endif
         {
             using task_type = apply_body_task_bypass<class_type, input_type>;
-            t = allocator.new_object<task_type>(my_graph_ref, allocator, *this, input, my_priority);
+            t = allocator.new_object<task_type>(my_graph_ref, allocator, *this, std::forward<In>(input), my_priority);
         }
+        bind_task(*t);
         return t;
     }
 
@@ -463,6 +562,9 @@ public:
     output_type apply_body_impl( const input_type& i) {
         // There is an extra copied needed to capture the
         // body execution without the try_put
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        node_statistics::body_scope scope(this->my_statistics);
+#endif
         fgt_begin_body( my_body );
         output_type v = tbb::detail::invoke(*my_body, i);
         fgt_end_body( my_body );
@@ -484,7 +586,11 @@ public:
             // execution policy
             spawn_in_graph_arena(base_type::graph_reference(), *postponed_task);
         }
+#if __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES
+        graph_task* successor_task = successors().try_put_task_move(std::move(v) __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+#else
         graph_task* successor_task = successors().try_put_task(v __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+#endif
 #if _MSC_VER && !__INTEL_COMPILER
 #pragma warning (push)
 #pragma warning (disable: 4127)  /* suppress conditional expression is constant */
@@ -574,6 +680,9 @@ public:
       , my_body( new multifunction_body_leaf<input_type, output_ports_type, Body>(body) )
       , my_init_body( new multifunction_body_leaf<input_type, output_ports_type, Body>(body) )
       , my_output_ports(init_output_ports<output_ports_type>::call(g, my_output_ports)){
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        statistics_ports<N>::set_statistics(my_output_ports, &this->my_statistics);
+#endif
     }
 
     //! Copy constructor
@@ -582,6 +691,9 @@ public:
         my_body( src.my_init_body->clone() ),
         my_init_body(src.my_init_body->clone() ),
         my_output_ports( init_output_ports<output_ports_type>::call(src.my_graph_ref, my_output_ports) ) {
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        statistics_ports<N>::set_statistics(my_output_ports, &this->my_statistics);
+#endif
     }
 
     ~multifunction_input() {
@@ -601,9 +713,14 @@ public:
     graph_task* apply_body_impl_bypass( const input_type &i
                                         __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo&) )
     {
-        fgt_begin_body( my_body );
-        (*my_body)(i, my_output_ports);
-        fgt_end_body( my_body );
+        {
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+            node_statistics::body_scope scope(this->my_statistics);
+#endif
+            fgt_begin_body( my_body );
+            (*my_body)(i, my_output_ports);
+            fgt_end_body( my_body );
+        }
         graph_task* ttask = nullptr;
         if(base_type::my_max_concurrency != 0) {
             ttask = base_type::try_get_postponed_task(i);
@@ -691,7 +808,7 @@ struct emit_element<1> {
 
 //! Implements methods for an executable node that takes continue_msg as input
 template< typename Output, typename Policy>
-class continue_input : public continue_receiver {
+class continue_input : public continue_receiver, public node_arena_binding {
 public:
 
     //! The input type of this receiver
@@ -744,12 +861,48 @@ public:
         }
     }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    node_statistics& statistics() { return my_statistics; }
+    const node_statistics& statistics() const { return my_statistics; }
+#endif
+
 protected:
 
     graph& my_graph_ref;
     function_body_type *my_body;
     function_body_type *my_init_body;
 
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    //! Counts the signals as the messages in
+    node_statistics my_statistics;
+
+    graph_task* try_put_task( const input_type& input ) override {
+        my_statistics.record_put(true);
+        return continue_receiver::try_put_task(input);
+    }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+    graph_task* try_put_task( const input_type& input, const message_metainfo& metainfo ) override {
+        my_statistics.record_put(true);
+        return continue_receiver::try_put_task(input, metainfo);
+    }
+#endif
+
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+    graph_task* try_put_task_fused( const input_type& input ) override {
+        my_statistics.record_put(true);
+        return continue_receiver::try_put_task_fused(input);
+    }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+    graph_task* try_put_task_fused( const input_type& input, const message_metainfo& metainfo ) override {
+        my_statistics.record_put(true);
+        return continue_receiver::try_put_task_fused(input, metainfo);
+    }
+#endif
+#endif
+#endif
+
     virtual broadcast_cache<output_type > &successors() = 0;
 
     friend class apply_body_task_bypass< class_type, continue_msg >;
@@ -757,13 +910,21 @@ protected:
     friend class apply_body_task_bypass< class_type, continue_msg, trackable_messages_graph_task >;
 #endif
 
-    //! Applies the body to the provided input
-    graph_task* apply_body_bypass( input_type __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo) ) {
+    output_type apply_body_impl() {
         // There is an extra copied needed to capture the
         // body execution without the try_put
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        node_statistics::body_scope scope(my_statistics);
+#endif
         fgt_begin_body( my_body );
         output_type v = (*my_body)( continue_msg() );
         fgt_end_body( my_body );
+        return v;
+    }
+
+    //! Applies the body to the provided input
+    graph_task* apply_body_bypass( input_type __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo) ) {
+        output_type v = apply_body_impl();
         return successors().try_put_task( v __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo) );
     }
 
@@ -779,7 +940,7 @@ protected:
 #pragma warning (push)
 #pragma warning (disable: 4127)  /* suppress conditional expression is constant */
 #endif
-        if(has_policy<lightweight, Policy>::value) {
+        if(has_policy<lightweight, Policy>::value && !is_bound_to_arena()) {
 #if _MSC_VER && !__INTEL_COMPILER
 #pragma warning (pop)
 #endif
@@ -798,10 +959,29 @@ protected:
                 using task_type = apply_body_task_bypass<class_type, continue_msg>;
                 t = allocator.new_object<task_type>( graph_reference(), allocator, *this, continue_msg(), my_priority );
             }
+            bind_task(*t);
             return t;
         }
     }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+    bool is_fusible() override { return my_priority == no_priority && !is_bound_to_arena(); }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+    graph_task* execute_fused(const message_metainfo& metainfo) override {
+        if(!is_graph_active(my_graph_ref) || is_graph_cancelled(my_graph_ref) || is_bound_to_arena()) {
+            return execute(metainfo);
+        }
+#else
+    graph_task* execute_fused() override {
+        if(!is_graph_active(my_graph_ref) || is_graph_cancelled(my_graph_ref) || is_bound_to_arena()) {
+            return execute();
+        }
+#endif
+        return apply_body_bypass( continue_msg() __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo) );
+    }
+#endif
+
     graph& graph_reference() const override {
         return my_graph_ref;
     }
@@ -851,16 +1031,16 @@ public:
     multifunction_output(const multifunction_output& other) : base_type(other.my_graph_ref) {}
 
     bool try_put(const output_type &i) {
-        graph_task *res = try_put_task(i);
-        if( !res ) return false;
-        if( res != SUCCESSFULLY_ENQUEUED ) {
-            // wrapping in task_arena::execute() is not needed since the method is called from
-            // inside task::execute()
-            spawn_in_graph_arena(graph_reference(), *res);
-        }
-        return true;
+        return spawn_put_task(try_put_task(i));
     }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES
+    //! Copies the item to all successors but the last one, which takes it over
+    bool try_put(output_type&& i) {
+        return spawn_put_task(my_successors.try_put_task_move(std::move(i)));
+    }
+#endif
+
     using base_type::graph_reference;
 
 protected:
@@ -875,6 +1055,16 @@ protected:
     }
 #endif
 
+    bool spawn_put_task(graph_task* res) {
+        if( !res ) return false;
+        if( res != SUCCESSFULLY_ENQUEUED ) {
+            // wrapping in task_arena::execute() is not needed since the method is called from
+            // inside task::execute()
+            spawn_in_graph_arena(graph_reference(), *res);
+        }
+        return true;
+    }
+
     template <int N> friend struct emit_element;
 
 };  // multifunction_output
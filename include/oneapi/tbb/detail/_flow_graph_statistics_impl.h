@@ -0,0 +1,211 @@
+/*
+    Copyright (c) 2025 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef __TBB__flow_graph_statistics_impl_H
+#define __TBB__flow_graph_statistics_impl_H
+
+#ifndef __TBB_flow_graph_H
+#error Do not #include this internal file directly; use public TBB headers instead.
+#endif
+
+// included in namespace tbb::detail::d2 (in flow_graph.h)
+
+//! Runtime counters of a flow graph node
+/** The node updates the counters where it reports the messages and the body calls to the
+    profiling tools. The counters are relaxed atomics, so the values read while the graph runs
+    are not a consistent snapshot. **/
+class node_statistics : no_copy {
+public:
+    typedef std::chrono::steady_clock clock_type;
+
+    explicit node_statistics( std::size_t concurrency_limit = 0 )
+        : my_concurrency_limit(concurrency_limit), my_start(clock_type::now()) {}
+
+    //! The number of messages accepted by the node
+    std::size_t messages_in() const { return my_messages_in.load(std::memory_order_relaxed); }
+
+    //! The number of messages rejected by the node
+    std::size_t rejections() const { return my_rejections.load(std::memory_order_relaxed); }
+
+    //! The number of messages accepted by the successors of the node
+    std::size_t messages_out() const { return my_messages_out.load(std::memory_order_relaxed); }
+
+    //! The largest number of messages buffered by the node at once
+    std::size_t max_queue_size() const { return my_max_queue_size.load(std::memory_order_relaxed); }
+
+    //! The number of completed body calls
+    std::size_t body_calls() const { return my_body_calls.load(std::memory_order_relaxed); }
+
+    //! The total time spent in the body; for the multifunction nodes, it includes the puts from the body
+    std::chrono::nanoseconds body_time() const {
+        return std::chrono::nanoseconds(my_body_time.load(std::memory_order_relaxed));
+    }
+
+    //! The largest number of body calls that run at once
+    std::size_t max_concurrency() const { return my_max_concurrency.load(std::memory_order_relaxed); }
+
+    //! The concurrency limit of the node; 0 if the node is not limited
+    std::size_t concurrency_limit() const { return my_concurrency_limit; }
+
+    //! The body time divided by the time passed since the construction or the last reset
+    double average_concurrency() const {
+        std::chrono::duration<double> elapsed = clock_type::now() - my_start;
+        std::chrono::duration<double> busy = body_time();
+        return elapsed.count() > 0 ? busy.count() / elapsed.count() : 0.;
+    }
+
+    //! The average concurrency divided by the concurrency limit; 0 if the node is not limited
+    double utilization() const {
+        return my_concurrency_limit ? average_concurrency() / double(my_concurrency_limit) : 0.;
+    }
+
+    //! Sets the counters to zero; call it when the graph is idle
+    void reset() {
+        my_messages_in.store(0, std::memory_order_relaxed);
+        my_rejections.store(0, std::memory_order_relaxed);
+        my_messages_out.store(0, std::memory_order_relaxed);
+        my_max_queue_size.store(0, std::memory_order_relaxed);
+        my_body_calls.store(0, std::memory_order_relaxed);
+        my_body_time.store(0, std::memory_order_relaxed);
+        my_max_concurrency.store(0, std::memory_order_relaxed);
+        my_start = clock_type::now();
+    }
+
+    // The rest is updated by the node
+
+    void record_put( bool accepted ) {
+        (accepted ? my_messages_in : my_rejections).fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void record_output() {
+        my_messages_out.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void record_queue_size( std::size_t size ) {
+        update_max(my_max_queue_size, size);
+    }
+
+    void set_concurrency_limit( std::size_t limit ) { my_concurrency_limit = limit; }
+
+    //! Measures a body call
+    class body_scope : no_copy {
+    public:
+        explicit body_scope( node_statistics& s ) : my_statistics(s) {
+            update_max(s.my_max_concurrency, s.my_active.fetch_add(1, std::memory_order_relaxed) + 1);
+            my_start = clock_type::now();
+        }
+
+        ~body_scope() {
+            std::chrono::nanoseconds elapsed =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - my_start);
+            my_statistics.my_body_time.fetch_add(elapsed.count(), std::memory_order_relaxed);
+            my_statistics.my_body_calls.fetch_add(1, std::memory_order_relaxed);
+            my_statistics.my_active.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+    private:
+        node_statistics& my_statistics;
+        clock_type::time_point my_start;
+    };
+
+private:
+    static void update_max( std::atomic<std::size_t>& max_value, std::size_t value ) {
+        std::size_t current = max_value.load(std::memory_order_relaxed);
+        while (current < value && !max_value.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+    }
+
+    std::atomic<std::size_t> my_messages_in{0};
+    std::atomic<std::size_t> my_rejections{0};
+    std::atomic<std::size_t> my_messages_out{0};
+    std::atomic<std::size_t> my_max_queue_size{0};
+    std::atomic<std::size_t> my_body_calls{0};
+    std::atomic<std::chrono::nanoseconds::rep> my_body_time{0};
+    std::atomic<std::size_t> my_active{0};
+    std::atomic<std::size_t> my_max_concurrency{0};
+    std::size_t my_concurrency_limit;
+    clock_type::time_point my_start;
+}; // class node_statistics
+
+//! The ports, edges and statistics of a node, filled by graph_node::describe for graph_to_dot
+struct node_description {
+    struct edge {
+        std::size_t port;
+        const void* successor;
+    };
+
+    //! FLOW_NULL if the node does not describe itself
+    string_resource_index type{FLOW_NULL};
+    const node_statistics* statistics{nullptr};
+    //! The receivers of the node in the order of its input ports
+    std::vector<const void*> inputs;
+    std::size_t num_outputs{0};
+    std::vector<edge> edges;
+
+    template <typename T>
+    void add_input( const receiver<T>& r ) {
+        inputs.push_back(&r);
+    }
+
+    //! Adds the edges to the successors as the next output port
+    template <typename T, typename M>
+    void add_output( successor_cache<T, M>& successors ) {
+        std::size_t port = num_outputs++;
+        successors.for_each_successor([this, port]( const receiver<T>* r ) {
+            edges.push_back(edge{port, r});
+        });
+    }
+};
+
+//! Helpers for the tuples of input and output ports
+template <int N>
+struct statistics_ports {
+    template <typename Ports>
+    static void add_inputs( node_description& d, Ports& ports ) {
+        statistics_ports<N - 1>::add_inputs(d, ports);
+        d.add_input(std::get<N - 1>(ports));
+    }
+
+    template <typename Ports>
+    static void add_outputs( node_description& d, Ports& ports ) {
+        statistics_ports<N - 1>::add_outputs(d, ports);
+        d.add_output(std::get<N - 1>(ports).successors());
+    }
+
+    template <typename Ports>
+    static void set_statistics( Ports& ports, node_statistics* s ) {
+        statistics_ports<N - 1>::set_statistics(ports, s);
+        std::get<N - 1>(ports).successors().set_statistics(s);
+    }
+};
+
+template <>
+struct statistics_ports<0> {
+    template <typename Ports> static void add_inputs( node_description&, Ports& ) {}
+    template <typename Ports> static void add_outputs( node_description&, Ports& ) {}
+    template <typename Ports> static void set_statistics( Ports&, node_statistics* ) {}
+};
+
+//! Returns the name the profiling tools show for the type of a node
+inline const char* node_type_name( string_resource_index index ) {
+    switch (index) {
+#define TBB_STRING_RESOURCE(index_name, str) case index_name: return str;
+#include "_string_resource.h"
+#undef TBB_STRING_RESOURCE
+    default: return "node";
+    }
+}
+
+#endif // __TBB__flow_graph_statistics_impl_H
@@ -29,6 +29,14 @@ namespace d2 {
 template< typename T > class sender;
 template< typename T > class receiver;
 
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+static inline void fgt_record_name( const graph_node *node, const char *desc ) {
+    record_node_name( *node, desc );
+}
+#else
+static inline void fgt_record_name( const graph_node * /*node*/, const char * /*desc*/ ) { }
+#endif
+
 #if TBB_USE_PROFILING_TOOLS
     #if __TBB_FLOW_TRACE_CODEPTR
         #if (_MSC_VER >= 1900)
@@ -168,18 +176,21 @@ template< typename NodeType >
 void fgt_multioutput_node_desc( const NodeType *node, const char *desc ) {
     void *addr =  (void *)( static_cast< receiver< typename NodeType::input_type > * >(const_cast< NodeType *>(node)) );
     itt_metadata_str_add( d1::ITT_DOMAIN_FLOW, addr, FLOW_NODE, FLOW_OBJECT_NAME, desc );
+    fgt_record_name( node, desc );
 }
 
 template< typename NodeType >
 void fgt_multiinput_multioutput_node_desc( const NodeType *node, const char *desc ) {
     void *addr =  const_cast<NodeType *>(node);
     itt_metadata_str_add( d1::ITT_DOMAIN_FLOW, addr, FLOW_NODE, FLOW_OBJECT_NAME, desc );
+    fgt_record_name( node, desc );
 }
 
 template< typename NodeType >
 static inline void fgt_node_desc( const NodeType *node, const char *desc ) {
     void *addr =  (void *)( static_cast< sender< typename NodeType::output_type > * >(const_cast< NodeType *>(node)) );
     itt_metadata_str_add( d1::ITT_DOMAIN_FLOW, addr, FLOW_NODE, FLOW_OBJECT_NAME, desc );
+    fgt_record_name( node, desc );
 }
 
 static inline void fgt_graph_desc( const void *g, const char *desc ) {
@@ -305,10 +316,14 @@ static inline void fgt_composite ( void* /*codeptr*/, void * /*node*/, void * /*
 static inline void fgt_graph( void * /*g*/ ) { }
 
 template< typename NodeType >
-static inline void fgt_multioutput_node_desc( const NodeType * /*node*/, const char * /*desc*/ ) { }
+static inline void fgt_multioutput_node_desc( const NodeType *node, const char *desc ) {
+    fgt_record_name( node, desc );
+}
 
 template< typename NodeType >
-static inline void fgt_node_desc( const NodeType * /*node*/, const char * /*desc*/ ) { }
+static inline void fgt_node_desc( const NodeType *node, const char *desc ) {
+    fgt_record_name( node, desc );
+}
 
 static inline void fgt_graph_desc( const void * /*g*/, const char * /*desc*/ ) { }
 
@@ -343,7 +358,9 @@ static inline void fgt_reserve_wait( void * /*graph*/ ) { }
 static inline void fgt_release_wait( void * /*graph*/ ) { }
 
 template< typename NodeType >
-void fgt_multiinput_multioutput_node_desc( const NodeType * /*node*/, const char * /*desc*/ ) { }
+void fgt_multiinput_multioutput_node_desc( const NodeType *node, const char *desc ) {
+    fgt_record_name( node, desc );
+}
 
 template < typename PortsTuple, int N >
 struct fgt_internal_input_alias_helper {
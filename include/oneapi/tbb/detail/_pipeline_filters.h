@@ -130,11 +130,18 @@ private:
 template<typename Body, typename InputType, typename OutputType >
 class concrete_filter;
 
+#if __TBB_PREVIEW_PIPELINE_BATCHING
+template<typename OutputType, typename Body> struct batch_input_body;
+#endif
+
 //! input_filter control to signal end-of-input for parallel_pipeline
 class flow_control {
     bool is_pipeline_stopped = false;
     flow_control() = default;
     template<typename Body, typename InputType, typename OutputType > friend class concrete_filter;
+#if __TBB_PREVIEW_PIPELINE_BATCHING
+    template<typename OutputType, typename Body> friend struct batch_input_body;
+#endif
     template<typename Output>
     __TBB_requires(std::copyable<Output>)
     friend class d2::input_node;
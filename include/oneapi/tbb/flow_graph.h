@@ -53,7 +53,20 @@
 #include <tuple>
 #include <list>
 #include <forward_list>
+#include <iterator>
 #include <queue>
+#if __TBB_PREVIEW_FLOW_GRAPH_BATCHING || __TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS \
+    || __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION || __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+#include <vector>
+#endif
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION || __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+#include <algorithm>
+#include <functional>
+#endif
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+#include <chrono>
+#include <string>
+#endif
 #if __TBB_CPP20_CONCEPTS_PRESENT
 #include <concepts>
 #endif
@@ -282,7 +295,10 @@ class receiver {
 private:
     template <typename... TryPutTaskArgs>
     bool internal_try_put(const T& t, TryPutTaskArgs&&... args) {
-        graph_task* res = try_put_task(t, std::forward<TryPutTaskArgs>(args)...);
+        return spawn_put_task(try_put_task(t, std::forward<TryPutTaskArgs>(args)...));
+    }
+
+    bool spawn_put_task(graph_task* res) {
         if (!res) return false;
         if (res != SUCCESSFULLY_ENQUEUED) spawn_in_graph_arena(graph_reference(), *res);
         return true;
@@ -297,6 +313,13 @@ public:
         return internal_try_put(t);
     }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES
+    //! Put an item to the receiver, which moves from the item if it accepts it
+    bool try_put( T&& t ) {
+        return spawn_put_task(try_put_task_move(std::move(t)));
+    }
+#endif
+
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
     //! Put an item to the receiver and wait for completion
     bool try_put_and_wait( const T& t ) {
@@ -329,10 +352,35 @@ protected:
 #endif
     virtual graph& graph_reference() const = 0;
 
+#if __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES
+    //! Puts an item that may be moved from, but only if the receiver accepts it
+    /** The receivers that do not store the items copy them. */
+    virtual graph_task* try_put_task_move(T&& t) { return try_put_task(t); }
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+    virtual graph_task* try_put_task_move(T&& t, const message_metainfo& metainfo) {
+        return try_put_task(t, metainfo);
+    }
+#endif
+#endif
+
     template<typename TT, typename M> friend class successor_cache;
     template< typename TTT > friend class overwrite_node;
     virtual bool is_continue_receiver() { return false; }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+    //! Returns true if the only predecessor may execute the receiver inline
+    virtual bool is_fusible() { return false; }
+
+    //! Puts the item on behalf of a predecessor that is executed by a graph task
+    /** The receiver may execute its body inline instead of returning a task. */
+    virtual graph_task* try_put_task_fused(const T& t) { return try_put_task(t); }
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+    virtual graph_task* try_put_task_fused(const T& t, const message_metainfo& metainfo) {
+        return try_put_task(t, metainfo);
+    }
+#endif
+#endif
+
     // TODO revamp: reconsider the inheritance and move node priority out of receiver
     virtual node_priority_t priority() const { return no_priority; }
 
@@ -406,7 +454,11 @@ protected:
 
 private:
     // execute body is supposed to be too small to create a task for.
-    graph_task* try_put_task_impl( const input_type& __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo) ) {
+    graph_task* try_put_task_impl( const input_type& __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo)
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+                                   , bool fused = false
+#endif
+                                 ) {
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
         message_metainfo predecessor_metainfo;
 #endif
@@ -429,13 +481,19 @@ private:
 #endif
             }
         }
-#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION && __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+        graph_task* res = fused ? execute_fused(predecessor_metainfo) : execute(predecessor_metainfo);
+#elif __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+        graph_task* res = fused ? execute_fused() : execute();
+#elif __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
         graph_task* res = execute(predecessor_metainfo);
+#else
+        graph_task* res = execute();
+#endif
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
         for (auto waiter : predecessor_metainfo.waiters()) {
             waiter->release(1);
         }
-#else
-        graph_task* res = execute();
 #endif
         return res? res : SUCCESSFULLY_ENQUEUED;
     }
@@ -451,6 +509,18 @@ protected:
     }
 #endif
 
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+    graph_task* try_put_task_fused( const input_type& input ) override {
+        return try_put_task_impl(input __TBB_FLOW_GRAPH_METAINFO_ARG(message_metainfo{}), /*fused=*/true);
+    }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+    graph_task* try_put_task_fused( const input_type& input, const message_metainfo& metainfo ) override {
+        return try_put_task_impl(input, metainfo, /*fused=*/true);
+    }
+#endif
+#endif
+
     spin_mutex my_mutex;
     int my_predecessor_count;
     int my_current_count;
@@ -477,6 +547,15 @@ protected:
     virtual graph_task* execute(const message_metainfo& metainfo) = 0;
 #else
     virtual graph_task* execute() = 0;
+#endif
+
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+    //! Like execute(), called when the last signal comes from a fused predecessor
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+    virtual graph_task* execute_fused(const message_metainfo& metainfo) { return execute(metainfo); }
+#else
+    virtual graph_task* execute_fused() { return execute(); }
+#endif
 #endif
     template<typename TT, typename M> friend class successor_cache;
     bool is_continue_receiver() override { return true; }
@@ -503,6 +582,9 @@ namespace detail {
 namespace d2 {
 
 #include "detail/_flow_graph_body_impl.h"
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+#include "detail/_flow_graph_statistics_impl.h"
+#endif
 #include "detail/_flow_graph_cache_impl.h"
 #include "detail/_flow_graph_types_impl.h"
 
@@ -636,14 +718,204 @@ inline graph_node::~graph_node() {
     my_graph.remove_node(this);
 }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+//! Makes the function and continue nodes execute their only successor inline
+/** A node is fused with its successor if the node is not lightweight and the successor is a
+    queueing function or continue node without priority. A chain of fused nodes costs one task
+    per message instead of one task per node; the concurrency limit of each node still applies.
+    The edges that form a cycle are not fused, or else the inline execution would follow the cycle.
+    Adding or removing a successor stops the fusion of the node until the function is called again.
+    The function is not thread safe; call it when the graph is idle.
+    Returns the number of fused edges. */
+inline std::size_t fuse_serial_chains(graph& g) {
+    std::vector<graph_node*> nodes;
+    std::vector<fusion_link> links;
+    for (graph::iterator it = g.begin(); it != g.end(); ++it) {
+        fusion_link link = it->fusion_candidate();
+        if (link.successor) {
+            nodes.push_back(&*it);
+            links.push_back(link);
+        } else {
+            it->set_fused(false);
+        }
+    }
+
+    const std::size_t num_links = links.size();
+    auto input_less = [&links](std::size_t i, const void* input) {
+        return std::less<const void*>()(links[i].input, input);
+    };
+    std::vector<std::size_t> by_input(num_links);
+    for (std::size_t i = 0; i < num_links; ++i) {
+        by_input[i] = i;
+    }
+    std::sort(by_input.begin(), by_input.end(), [&](std::size_t i, std::size_t j) {
+        return input_less(i, links[j].input);
+    });
+    // The link that starts at the successor of each link, or num_links if there is none
+    std::vector<std::size_t> next_link(num_links);
+    for (std::size_t i = 0; i < num_links; ++i) {
+        auto found = std::lower_bound(by_input.begin(), by_input.end(), links[i].successor, input_less);
+        next_link[i] = found != by_input.end() && links[*found].input == links[i].successor ? *found : num_links;
+    }
+
+    // Each link has at most one next link, so every walk ends either outside the links or in a cycle
+    enum link_state : char { unvisited, on_path, acyclic, on_cycle };
+    std::vector<link_state> state(num_links, unvisited);
+    for (std::size_t i = 0; i < num_links; ++i) {
+        std::size_t j = i;
+        for (; j != num_links && state[j] == unvisited; j = next_link[j]) {
+            state[j] = on_path;
+        }
+        if (j != num_links && state[j] == on_path) {
+            std::size_t k = j;
+            do {
+                state[k] = on_cycle;
+                k = next_link[k];
+            } while (k != j);
+        }
+        for (j = i; j != num_links && state[j] == on_path; j = next_link[j]) {
+            state[j] = acyclic;
+        }
+    }
+
+    std::size_t num_fused = 0;
+    for (std::size_t i = 0; i < num_links; ++i) {
+        nodes[i]->set_fused(state[i] == acyclic);
+        num_fused += state[i] == acyclic;
+    }
+    return num_fused;
+}
+#endif // __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+//! Returns the graph in the Graphviz DOT format with the statistics of each node
+/** The nodes are labeled with the names given by set_name and with their statistics; the nodes
+    that do not describe themselves, such as composite_node and the user-defined nodes, are not shown.
+    The statistics can be read while the graph runs, but the edges must not be changed meanwhile. */
+inline std::string graph_to_dot(graph& g) {
+    std::vector<graph_node*> nodes;
+    std::vector<node_description> descriptions;
+    for (graph::iterator it = g.begin(); it != g.end(); ++it) {
+        node_description d;
+        it->describe(d);
+        if (d.type != FLOW_NULL) {
+            nodes.push_back(&*it);
+            descriptions.push_back(std::move(d));
+        }
+    }
+
+    // The node and the input port of each receiver, sorted by the receiver address
+    struct input_port {
+        const void* receiver;
+        std::size_t node;
+        std::size_t port;
+    };
+    auto receiver_less = [](const input_port& p, const void* r) {
+        return std::less<const void*>()(p.receiver, r);
+    };
+    std::vector<input_port> inputs;
+    for (std::size_t i = 0; i < descriptions.size(); ++i) {
+        for (std::size_t port = 0; port < descriptions[i].inputs.size(); ++port) {
+            inputs.push_back(input_port{descriptions[i].inputs[port], i, port});
+        }
+    }
+    std::sort(inputs.begin(), inputs.end(), [&](const input_port& a, const input_port& b) {
+        return receiver_less(a, b.receiver);
+    });
+
+    std::string dot = "digraph G {\n";
+    for (std::size_t i = 0; i < descriptions.size(); ++i) {
+        const node_description& d = descriptions[i];
+        std::string label;
+        for (char c : nodes[i]->my_name) {
+            if (c == '"' || c == '\\') {
+                label += '\\';
+            }
+            label += c;
+        }
+        label += label.empty() ? "" : "\\n";
+        label += node_type_name(d.type);
+        if (const node_statistics* s = d.statistics) {
+            label += "\\nin " + std::to_string(s->messages_in()) + ", rejected " + std::to_string(s->rejections())
+                   + ", out " + std::to_string(s->messages_out());
+            label += "\\nmax queue " + std::to_string(s->max_queue_size());
+            label += "\\nbody calls " + std::to_string(s->body_calls()) + ", "
+                   + std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(s->body_time()).count())
+                   + " us";
+            label += "\\nconcurrency " + std::to_string(s->max_concurrency()) + " of "
+                   + (s->concurrency_limit() ? std::to_string(s->concurrency_limit()) : std::string("unlimited"));
+            if (s->concurrency_limit()) {
+                label += ", utilization " + std::to_string(static_cast<int>(s->utilization() * 100)) + "%";
+            }
+        }
+        dot += "  n" + std::to_string(i) + " [shape=box, label=\"" + label + "\"];\n";
+    }
+    for (std::size_t i = 0; i < descriptions.size(); ++i) {
+        const node_description& d = descriptions[i];
+        for (const node_description::edge& e : d.edges) {
+            auto found = std::lower_bound(inputs.begin(), inputs.end(), e.successor, receiver_less);
+            if (found == inputs.end() || found->receiver != e.successor) {
+                continue;
+            }
+            dot += "  n" + std::to_string(i) + " -> n" + std::to_string(found->node);
+            std::string attributes;
+            if (d.num_outputs > 1) {
+                attributes = "taillabel=\"" + std::to_string(e.port) + "\"";
+            }
+            if (descriptions[found->node].inputs.size() > 1) {
+                attributes += (attributes.empty() ? "" : ", ") + std::string("headlabel=\"")
+                            + std::to_string(found->port) + "\"";
+            }
+            dot += attributes.empty() ? ";\n" : " [" + attributes + "];\n";
+        }
+    }
+    dot += "}\n";
+    return dot;
+}
+#endif // __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_ARENAS
+inline void set_nodes_arena(task_arena*) {}
+
+template <typename Node, typename... Nodes>
+void set_nodes_arena(task_arena* a, Node& n, Nodes&... nodes) {
+    set_node_arena(n, a);
+    set_nodes_arena(a, nodes...);
+}
+
+//! Makes the arena execute the bodies of the nodes
+/** The node tasks are submitted to the arena instead of being spawned or bypassed, so the arena
+    needs the slots for the worker threads, and it must outlive the execution of the graph.
+    Throws std::invalid_argument if the arena has no such slots. Call it when the graph is idle. */
+template <typename... Nodes>
+void bind_to_arena(task_arena& a, Nodes&... nodes) {
+    a.initialize();
+    // No thread would take the tasks submitted to the arena, and wait_for_all would never return
+    __TBB_ASSERT(num_worker_slots(a) > 0, "The arena of the nodes must have slots for worker threads");
+    if (num_worker_slots(a) == 0) {
+        throw_exception(exception_id::no_worker_slots);
+    }
+    set_nodes_arena(&a, nodes...);
+}
+
+//! Makes the arena of the graph execute the bodies of the nodes again; call it when the graph is idle
+template <typename... Nodes>
+void unbind_from_arena(Nodes&... nodes) {
+    set_nodes_arena(nullptr, nodes...);
+}
+#endif // __TBB_PREVIEW_FLOW_GRAPH_NODE_ARENAS
+
 #include "detail/_flow_graph_node_impl.h"
+#if __TBB_PREVIEW_FLOW_GRAPH_BATCHING
+#include "detail/_flow_graph_batch_impl.h"
+#endif
 
 
 //! An executable node that acts as a source, i.e. it has no predecessors
 
 template < typename Output >
     __TBB_requires(std::copyable<Output>)
-class input_node : public graph_node, public sender< Output > {
+class input_node : public graph_node, public sender< Output >, node_arena_binding {
 public:
     //! The type of the output message, which is complete
     typedef Output output_type;
@@ -662,9 +934,15 @@ public:
          , my_body( new input_body_leaf< output_type, Body>(body) )
          , my_init_body( new input_body_leaf< output_type, Body>(body) )
          , my_successors(this), my_reserved(false), my_has_cached_item(false)
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+         , my_statistics(1)
+#endif
     {
         fgt_node_with_body(CODEPTR(), FLOW_INPUT_NODE, &this->my_graph,
                            static_cast<sender<output_type> *>(this), this->my_body);
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        my_successors.set_statistics(&my_statistics);
+#endif
     }
 
 #if __TBB_PREVIEW_FLOW_GRAPH_NODE_SET
@@ -683,9 +961,15 @@ public:
         , my_active(false)
         , my_body(src.my_init_body->clone()), my_init_body(src.my_init_body->clone())
         , my_successors(this), my_reserved(false), my_has_cached_item(false)
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        , my_statistics(1)
+#endif
     {
         fgt_node_with_body(CODEPTR(), FLOW_INPUT_NODE, &this->my_graph,
                            static_cast<sender<output_type> *>(this), this->my_body);
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        my_successors.set_statistics(&my_statistics);
+#endif
     }
 
     //! The destructor
@@ -716,6 +1000,9 @@ public:
         if ( my_has_cached_item ) {
             v = my_cached_item;
             my_has_cached_item = false;
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+            my_statistics.record_output();
+#endif
             return true;
         }
         // we've been asked to provide an item, but we have none.  enqueue a task to
@@ -790,6 +1077,11 @@ public:
         return dynamic_cast< input_body_leaf<output_type, Body> & >(body_ref).get_body();
     }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    node_statistics& statistics() { return my_statistics; }
+    const node_statistics& statistics() const { return my_statistics; }
+#endif
+
 protected:
 
     //! resets the input_node to its initial state
@@ -806,6 +1098,20 @@ protected:
         }
     }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    void describe(node_description& d) override {
+        d.type = FLOW_INPUT_NODE;
+        d.statistics = &my_statistics;
+        d.add_output(my_successors);
+    }
+#endif
+
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_ARENAS
+    void set_task_arena(task_arena* a) override {
+        my_arena = a;
+    }
+#endif
+
 private:
     spin_mutex my_mutex;
     bool my_active;
@@ -815,6 +1121,9 @@ private:
     bool my_reserved;
     bool my_has_cached_item;
     output_type my_cached_item;
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    node_statistics my_statistics;
+#endif
 
     // used by apply_body_bypass, can invoke body of node.
     bool try_reserve_apply_body(output_type &v) {
@@ -824,6 +1133,9 @@ private:
         }
         if ( !my_has_cached_item ) {
             d1::flow_control control;
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+            node_statistics::body_scope scope(my_statistics);
+#endif
 
             fgt_begin_body( my_body );
 
@@ -845,6 +1157,7 @@ private:
         d1::small_object_allocator allocator{};
         typedef input_node_task_bypass< input_node<output_type> > task_type;
         graph_task* t = allocator.new_object<task_type>(my_graph, allocator, *this);
+        bind_task(*t);
         return t;
     }
 
@@ -906,6 +1219,9 @@ public:
           fOutput_type(g) {
         fgt_node_with_body( CODEPTR(), FLOW_FUNCTION_NODE, &this->my_graph,
                 static_cast<receiver<input_type> *>(this), static_cast<sender<output_type> *>(this), this->my_body );
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        successors().set_statistics(&this->my_statistics);
+#endif
     }
 
     template <typename Body>
@@ -935,6 +1251,9 @@ public:
         fOutput_type(src.my_graph) {
         fgt_node_with_body( CODEPTR(), FLOW_FUNCTION_NODE, &this->my_graph,
                 static_cast<receiver<input_type> *>(this), static_cast<sender<output_type> *>(this), this->my_body );
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        successors().set_statistics(&this->my_statistics);
+#endif
     }
 
 protected:
@@ -956,6 +1275,42 @@ protected:
         __TBB_ASSERT(this->my_predecessors.empty(), "function_node predecessors not empty");
     }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+    //! A lightweight node may be executed by the thread that puts the message, outside of a graph task;
+    //! the successor of a node bound to an arena would be executed in that arena
+    fusion_link fusion_candidate() override {
+        fusion_link link;
+        link.input = static_cast<receiver<input_type>*>(this);
+        link.successor = has_policy<lightweight, Policy>::value || this->is_bound_to_arena()
+                       ? nullptr : successors().fusible_successor();
+        return link;
+    }
+
+    void set_fused(bool fused) override {
+        successors().set_fused(fused);
+    }
+#endif
+
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    void describe(node_description& d) override {
+        d.type = FLOW_FUNCTION_NODE;
+        d.statistics = &this->my_statistics;
+        d.add_input<input_type>(*this);
+        d.add_output(successors());
+    }
+#endif
+
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_ARENAS
+    void set_task_arena(task_arena* a) override {
+        this->my_arena = a;
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+        // A fused successor would be executed in the arena of this node
+        if (a) {
+            successors().set_fused(false);
+        }
+#endif
+    }
+#endif
 };  // class function_node
 
 //! implements a function node that supports Input -> (set of outputs)
@@ -1034,8 +1389,165 @@ public:
     // all the guts are in multifunction_input...
 protected:
     void reset_node(reset_flags f) override { input_impl_type::reset(f); }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    void describe(node_description& d) override {
+        d.type = FLOW_MULTIFUNCTION_NODE;
+        d.statistics = &this->my_statistics;
+        d.add_input<input_type>(*this);
+        statistics_ports<N>::add_outputs(d, this->output_ports());
+    }
+#endif
+
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_ARENAS
+    void set_task_arena(task_arena* a) override {
+        this->my_arena = a;
+    }
+#endif
 };  // multifunction_node
 
+#if __TBB_PREVIEW_FLOW_GRAPH_BATCHING
+//! Implements a function node that applies its body to batches of up to max_batch_size messages
+/** The body is called as body(const std::vector<Input>& batch, std::vector<Output>& outputs);
+    all the outputs of the call are forwarded to the successors by the task that made the call. */
+template<typename Input, typename Output = continue_msg>
+    __TBB_requires(std::copy_constructible<Input> &&
+                   std::copy_constructible<Output>)
+class batch_function_node
+    : public graph_node
+    , public batch_function_input<Input, Output>
+    , public function_output<Output>
+{
+public:
+    typedef Input input_type;
+    typedef Output output_type;
+    typedef batch_function_input<input_type, output_type> input_impl_type;
+    typedef function_output<output_type> fOutput_type;
+    typedef typename input_impl_type::predecessor_type predecessor_type;
+    typedef typename fOutput_type::successor_type successor_type;
+
+    template <typename Body>
+    __TBB_NOINLINE_SYM batch_function_node( graph& g, size_t concurrency, size_t max_batch_size, Body body,
+                                            node_priority_t a_priority = no_priority )
+        : graph_node(g), input_impl_type(g, concurrency, max_batch_size, body, a_priority), fOutput_type(g) {
+        fgt_node( CODEPTR(), FLOW_FUNCTION_NODE, &this->my_graph,
+                  static_cast<receiver<input_type> *>(this), static_cast<sender<output_type> *>(this) );
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        successors().set_statistics(&this->my_statistics);
+#endif
+    }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_SET
+    template <typename Body, typename... Args>
+    batch_function_node( const node_set<Args...>& nodes, size_t concurrency, size_t max_batch_size, Body body,
+                         node_priority_t a_priority = no_priority )
+        : batch_function_node(nodes.graph_reference(), concurrency, max_batch_size, body, a_priority) {
+        make_edges_in_order(nodes, *this);
+    }
+#endif // __TBB_PREVIEW_FLOW_GRAPH_NODE_SET
+
+    //! Copy constructor
+    __TBB_NOINLINE_SYM batch_function_node( const batch_function_node& src )
+        : graph_node(src.my_graph), input_impl_type(src), fOutput_type(src.my_graph) {
+        fgt_node( CODEPTR(), FLOW_FUNCTION_NODE, &this->my_graph,
+                  static_cast<receiver<input_type> *>(this), static_cast<sender<output_type> *>(this) );
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        successors().set_statistics(&this->my_statistics);
+#endif
+    }
+
+protected:
+    template< typename R, typename B > friend class run_and_put_task;
+    template<typename X, typename Y> friend class broadcast_cache;
+    template<typename X, typename Y> friend class round_robin_cache;
+    using input_impl_type::try_put_task;
+
+    broadcast_cache<output_type> &successors () override { return fOutput_type::my_successors; }
+
+    void reset_node(reset_flags f) override {
+        input_impl_type::reset_batch_input(f);
+        if (f & rf_clear_edges) {
+            successors().clear();
+        }
+        __TBB_ASSERT(!(f & rf_clear_edges) || successors().empty(), "batch_function_node successors not empty");
+    }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    void describe(node_description& d) override {
+        d.type = FLOW_FUNCTION_NODE;
+        d.statistics = &this->my_statistics;
+        d.add_input<input_type>(*this);
+        d.add_output(successors());
+    }
+#endif
+
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_ARENAS
+    void set_task_arena(task_arena* a) override {
+        this->my_arena = a;
+    }
+#endif
+};  // class batch_function_node
+
+//! Implements a multifunction node that applies its body to batches of up to max_batch_size messages
+/** The body is called as body(const std::vector<Input>& batch, output_ports_type& ports). */
+template<typename Input, typename Output>
+    __TBB_requires(std::copy_constructible<Input>)
+class batch_multifunction_node
+    : public graph_node
+    , public batch_multifunction_input<
+        Input, typename wrap_tuple_elements<std::tuple_size<Output>::value, multifunction_output, Output>::type>
+{
+protected:
+    static const int N = std::tuple_size<Output>::value;
+public:
+    typedef Input input_type;
+    typedef null_type output_type;
+    typedef typename wrap_tuple_elements<N, multifunction_output, Output>::type output_ports_type;
+    typedef batch_multifunction_input<input_type, output_ports_type> input_impl_type;
+
+    template <typename Body>
+    __TBB_NOINLINE_SYM batch_multifunction_node( graph& g, size_t concurrency, size_t max_batch_size, Body body,
+                                                 node_priority_t a_priority = no_priority )
+        : graph_node(g), input_impl_type(g, concurrency, max_batch_size, body, a_priority) {
+        fgt_multioutput_node<N>( CODEPTR(), FLOW_MULTIFUNCTION_NODE, &this->my_graph,
+                                 static_cast<receiver<input_type> *>(this), this->output_ports() );
+    }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_SET
+    template <typename Body, typename... Args>
+    batch_multifunction_node( const node_set<Args...>& nodes, size_t concurrency, size_t max_batch_size, Body body,
+                              node_priority_t a_priority = no_priority )
+        : batch_multifunction_node(nodes.graph_reference(), concurrency, max_batch_size, body, a_priority) {
+        make_edges_in_order(nodes, *this);
+    }
+#endif // __TBB_PREVIEW_FLOW_GRAPH_NODE_SET
+
+    __TBB_NOINLINE_SYM batch_multifunction_node( const batch_multifunction_node& other )
+        : graph_node(other.my_graph), input_impl_type(other) {
+        fgt_multioutput_node<N>( CODEPTR(), FLOW_MULTIFUNCTION_NODE, &this->my_graph,
+                                 static_cast<receiver<input_type> *>(this), this->output_ports() );
+    }
+
+protected:
+    void reset_node(reset_flags f) override { input_impl_type::reset(f); }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    void describe(node_description& d) override {
+        d.type = FLOW_MULTIFUNCTION_NODE;
+        d.statistics = &this->my_statistics;
+        d.add_input<input_type>(*this);
+        statistics_ports<N>::add_outputs(d, this->output_ports());
+    }
+#endif
+
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_ARENAS
+    void set_task_arena(task_arena* a) override {
+        this->my_arena = a;
+    }
+#endif
+};  // class batch_multifunction_node
+#endif // __TBB_PREVIEW_FLOW_GRAPH_BATCHING
+
 //! split_node: accepts a tuple as input, forwards each element of the tuple to its
 //  successors.  The node has unlimited concurrency, so it does not reject inputs.
 template<typename TupleType>
@@ -1099,6 +1611,14 @@ protected:
         return my_graph;
     }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    void describe(node_description& d) override {
+        d.type = FLOW_SPLIT_NODE;
+        d.add_input<input_type>(*this);
+        statistics_ports<N>::add_outputs(d, my_output_ports);
+    }
+#endif
+
 private:
     output_ports_type my_output_ports;
 };
@@ -1128,6 +1648,9 @@ public:
 
                                            static_cast<receiver<input_type> *>(this),
                                            static_cast<sender<output_type> *>(this), this->my_body );
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        successors().set_statistics(&this->my_statistics);
+#endif
     }
 
     template <typename Body>
@@ -1161,6 +1684,9 @@ public:
         fgt_node_with_body( CODEPTR(), FLOW_CONTINUE_NODE, &this->my_graph,
                                            static_cast<receiver<input_type> *>(this),
                                            static_cast<sender<output_type> *>(this), this->my_body );
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        successors().set_statistics(&this->my_statistics);
+#endif
     }
 
     template <typename Body>
@@ -1191,6 +1717,9 @@ public:
         fgt_node_with_body( CODEPTR(), FLOW_CONTINUE_NODE, &this->my_graph,
                                            static_cast<receiver<input_type> *>(this),
                                            static_cast<sender<output_type> *>(this), this->my_body );
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        successors().set_statistics(&this->my_statistics);
+#endif
     }
 
 protected:
@@ -1205,6 +1734,43 @@ protected:
         if(f & rf_clear_edges)successors().clear();
         __TBB_ASSERT(!(f & rf_clear_edges) || successors().empty(), "continue_node not reset");
     }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+    //! A lightweight node may be executed by the thread that puts the message, outside of a graph task;
+    //! the successor of a node bound to an arena would be executed in that arena
+    fusion_link fusion_candidate() override {
+        fusion_link link;
+        link.input = static_cast<receiver<input_type>*>(this);
+        link.successor = has_policy<lightweight, Policy>::value || this->is_bound_to_arena()
+                       ? nullptr : successors().fusible_successor();
+        return link;
+    }
+
+    void set_fused(bool fused) override {
+        successors().set_fused(fused);
+    }
+#endif
+
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    void describe(node_description& d) override {
+        d.type = FLOW_CONTINUE_NODE;
+        d.statistics = &this->my_statistics;
+        d.add_input<input_type>(*this);
+        d.add_output(successors());
+    }
+#endif
+
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_ARENAS
+    void set_task_arena(task_arena* a) override {
+        this->my_arena = a;
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+        // A fused successor would be executed in the arena of this node
+        if (a) {
+            successors().set_fused(false);
+        }
+#endif
+    }
+#endif
 };  // continue_node
 
 //! Forwards messages of type T to all successors
@@ -1278,6 +1844,14 @@ protected:
         }
         __TBB_ASSERT(!(f & rf_clear_edges) || my_successors.empty(), "Error resetting broadcast_node");
     }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    void describe(node_description& d) override {
+        d.type = FLOW_BROADCAST_NODE;
+        d.add_input<input_type>(*this);
+        d.add_output(my_successors);
+    }
+#endif
 };  // broadcast_node
 
 //! Forwards messages in arbitrary order
@@ -1299,6 +1873,9 @@ public:
 protected:
     typedef size_t size_type;
     round_robin_cache< T, null_rw_mutex > my_successors;
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    node_statistics my_statistics;
+#endif
 
     friend class forward_task_bypass< class_type >;
 
@@ -1315,6 +1892,10 @@ protected:
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
         message_metainfo* metainfo{ nullptr };
 #endif
+#if __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES
+        //! The item of put_item was put as an rvalue and may be moved from
+        bool move_elem{ false };
+#endif
 
         buffer_operation(const T& e, op_type t) : type(char(t))
                                                   , elem(const_cast<T*>(&e)) , ltask(nullptr)
@@ -1364,6 +1945,9 @@ protected:
         }
 
         derived->order();
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        my_statistics.record_queue_size(this->my_tail - this->my_head);
+#endif
 
         if (try_forwarding && !forwarder_busy) {
             if(is_graph_active(this->my_graph)) {
@@ -1436,8 +2020,14 @@ private:
     }
 
     void try_put_and_add_task(graph_task*& last_task) {
+#if __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES
+        // The successor that accepts the item takes it over
+        graph_task* new_task = my_successors.try_put_task_move(std::move(this->back())
+                                                               __TBB_FLOW_GRAPH_METAINFO_ARG(this->back_metainfo()));
+#else
         graph_task* new_task = my_successors.try_put_task(this->back()
                                                           __TBB_FLOW_GRAPH_METAINFO_ARG(this->back_metainfo()));
+#endif
         if (new_task) {
             // workaround for icc bug
             graph& g = this->my_graph;
@@ -1481,10 +2071,15 @@ protected:
         __TBB_ASSERT(op->elem, nullptr);
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
         __TBB_ASSERT(op->metainfo, nullptr);
-        this->push_back(*(op->elem), (*op->metainfo));
-#else
-        this->push_back(*(op->elem));
 #endif
+#if __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES
+        if (op->move_elem) {
+            this->push_back(std::move(*(op->elem)) __TBB_FLOW_GRAPH_METAINFO_ARG(*(op->metainfo)));
+        } else
+#endif
+        {
+            this->push_back(this->copy_source(*(op->elem)) __TBB_FLOW_GRAPH_METAINFO_ARG(*(op->metainfo)));
+        }
         op->status.store(SUCCEEDED, std::memory_order_release);
         return true;
     }
@@ -1540,6 +2135,9 @@ public:
         my_aggregator.initialize_handler(handler_type(this));
         fgt_node( CODEPTR(), FLOW_BUFFER_NODE, &this->my_graph,
                                  static_cast<receiver<input_type> *>(this), static_cast<sender<output_type> *>(this) );
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        my_successors.set_statistics(&my_statistics);
+#endif
     }
 
 #if __TBB_PREVIEW_FLOW_GRAPH_NODE_SET
@@ -1590,7 +2188,7 @@ public:
         op_data.elem = &v;
         my_aggregator.execute(&op_data);
         (void)enqueue_forwarding_task(op_data);
-        return (op_data.status==SUCCEEDED);
+        return record_pull(op_data.status==SUCCEEDED);
     }
 
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
@@ -1599,7 +2197,7 @@ public:
         op_data.elem = &v;
         my_aggregator.execute(&op_data);
         (void)enqueue_forwarding_task(op_data);
-        return (op_data.status==SUCCEEDED);
+        return record_pull(op_data.status==SUCCEEDED);
     }
 #endif
 
@@ -1639,13 +2237,37 @@ public:
         buffer_operation op_data(con_res);
         my_aggregator.execute(&op_data);
         (void)enqueue_forwarding_task(op_data);
-        return true;
+        return record_pull(true);
     }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    node_statistics& statistics() { return my_statistics; }
+    const node_statistics& statistics() const { return my_statistics; }
+#endif
+
 private:
-    graph_task* try_put_task_impl(const T& t __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo)) {
+    //! Counts a message taken by a successor
+    bool record_pull(bool succeeded) {
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        if (succeeded) {
+            my_statistics.record_output();
+        }
+#endif
+        return succeeded;
+    }
+
+    graph_task* try_put_task_impl(const T& t __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo),
+                                  bool move_elem = false) {
         buffer_operation op_data(t, put_item __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+#if __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES
+        op_data.move_elem = move_elem;
+#else
+        suppress_unused_warning(move_elem);
+#endif
         my_aggregator.execute(&op_data);
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        my_statistics.record_put(op_data.status == SUCCEEDED);
+#endif
         graph_task *ft = grab_forwarding_task(op_data);
         // sequencer_nodes can return failure (if an item has been previously inserted)
         // We have to spawn the returned task if our own operation fails.
@@ -1668,16 +2290,30 @@ protected:
     template<typename X, typename Y> friend class broadcast_cache;
     template<typename X, typename Y> friend class round_robin_cache;
     //! receive an item, return a task *if possible
+    /** The items of move-only types are rejected unless they are put as rvalues. */
     graph_task *try_put_task(const T &t) override {
-        return try_put_task_impl(t __TBB_FLOW_GRAPH_METAINFO_ARG(message_metainfo{}));
+        return std::is_copy_constructible<T>::value
+            ? try_put_task_impl(t __TBB_FLOW_GRAPH_METAINFO_ARG(message_metainfo{})) : nullptr;
     }
 
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
     graph_task* try_put_task(const T& t, const message_metainfo& metainfo) override {
-        return try_put_task_impl(t, metainfo);
+        return std::is_copy_constructible<T>::value ? try_put_task_impl(t, metainfo) : nullptr;
     }
 #endif
 
+#if __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES
+    graph_task* try_put_task_move(T&& t) override {
+        return try_put_task_impl(t __TBB_FLOW_GRAPH_METAINFO_ARG(message_metainfo{}), /*move_elem=*/true);
+    }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+    graph_task* try_put_task_move(T&& t, const message_metainfo& metainfo) override {
+        return try_put_task_impl(t, metainfo, /*move_elem=*/true);
+    }
+#endif
+#endif
+
     graph& graph_reference() const override {
         return my_graph;
     }
@@ -1691,6 +2327,15 @@ protected:
         }
         forwarder_busy = false;
     }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    void describe(node_description& d) override {
+        d.type = FLOW_BUFFER_NODE;
+        d.statistics = &my_statistics;
+        d.add_input<input_type>(*this);
+        d.add_output(my_successors);
+    }
+#endif
 };  // buffer_node
 
 //! Forwards messages in FIFO order
@@ -1710,8 +2355,13 @@ private:
     }
 
     void try_put_and_add_task(graph_task*& last_task) {
+#if __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES
+        graph_task* new_task = this->my_successors.try_put_task_move(std::move(this->front())
+                                                                     __TBB_FLOW_GRAPH_METAINFO_ARG(this->front_metainfo()));
+#else
         graph_task* new_task = this->my_successors.try_put_task(this->front()
                                                                 __TBB_FLOW_GRAPH_METAINFO_ARG(this->front_metainfo()));
+#endif
 
         if (new_task) {
             // workaround for icc bug
@@ -1743,21 +2393,20 @@ protected:
         }
     }
     void internal_reserve(queue_operation *op) override {
-        if (this->my_reserved || !this->my_item_valid(this->my_head)) {
-            op->status.store(FAILED, std::memory_order_release);
-        }
-        else {
+        bool reserve_result = false;
+        if (!this->my_reserved && this->my_item_valid(this->my_head)) {
+            // The items of move-only types cannot be reserved
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
             if (op->metainfo) {
-                this->reserve_front(*(op->elem), *(op->metainfo));
+                reserve_result = this->reserve_front(*(op->elem), *(op->metainfo));
             }
             else
 #endif
             {
-                this->reserve_front(*(op->elem));
+                reserve_result = this->reserve_front(*(op->elem));
             }
-            op->status.store(SUCCEEDED, std::memory_order_release);
         }
+        op->status.store(reserve_result ? SUCCEEDED : FAILED, std::memory_order_release);
     }
     void internal_consume(queue_operation *op) override {
         this->consume_front();
@@ -1796,6 +2445,13 @@ protected:
     void reset_node( reset_flags f) override {
         base_type::reset_node(f);
     }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    void describe(node_description& d) override {
+        base_type::describe(d);
+        d.type = FLOW_QUEUE_NODE;
+    }
+#endif
 };  // queue_node
 
 //! Forwards messages in sequence order
@@ -1845,6 +2501,13 @@ protected:
     typedef typename buffer_node<T>::size_type size_type;
     typedef typename buffer_node<T>::buffer_operation sequencer_operation;
 
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    void describe(node_description& d) override {
+        queue_node<T>::describe(d);
+        d.type = FLOW_SEQUENCER_NODE;
+    }
+#endif
+
 private:
     bool internal_push(sequencer_operation *op) override {
         size_type tag = (*my_sequencer)(*(op->elem));
@@ -1865,11 +2528,19 @@ private:
 
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
         __TBB_ASSERT(op->metainfo, nullptr);
-        bool place_item_result = this->place_item(tag, *(op->elem), *(op->metainfo));
-        const op_stat res = place_item_result ? SUCCEEDED : FAILED;
-#else
-        const op_stat res = this->place_item(tag, *(op->elem)) ? SUCCEEDED : FAILED;
 #endif
+        bool place_item_result;
+#if __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES
+        if (op->move_elem) {
+            place_item_result = this->place_item(tag, std::move(*(op->elem))
+                                                 __TBB_FLOW_GRAPH_METAINFO_ARG(*(op->metainfo)));
+        } else
+#endif
+        {
+            place_item_result = this->place_item(tag, this->copy_source(*(op->elem))
+                                                 __TBB_FLOW_GRAPH_METAINFO_ARG(*(op->metainfo)));
+        }
+        const op_stat res = place_item_result ? SUCCEEDED : FAILED;
         op->status.store(res, std::memory_order_release);
         return res ==SUCCEEDED;
     }
@@ -1918,6 +2589,13 @@ protected:
         base_type::reset_node(f);
     }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    void describe(node_description& d) override {
+        base_type::describe(d);
+        d.type = FLOW_PRIORITY_QUEUE_NODE;
+    }
+#endif
+
     typedef typename buffer_node<T>::size_type size_type;
     typedef typename buffer_node<T>::item_type item_type;
     typedef typename buffer_node<T>::buffer_operation prio_operation;
@@ -1934,10 +2612,15 @@ protected:
     bool internal_push(prio_operation *op) override {
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
         __TBB_ASSERT(op->metainfo, nullptr);
-        prio_push(*(op->elem), *(op->metainfo));
-#else
-        prio_push(*(op->elem));
 #endif
+#if __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES
+        if (op->move_elem) {
+            prio_push(std::move(*(op->elem)) __TBB_FLOW_GRAPH_METAINFO_ARG(*(op->metainfo)));
+        } else
+#endif
+        {
+            prio_push(this->copy_source(*(op->elem)) __TBB_FLOW_GRAPH_METAINFO_ARG(*(op->metainfo)));
+        }
         op->status.store(SUCCEEDED, std::memory_order_release);
         return true;
     }
@@ -1949,34 +2632,37 @@ protected:
             return;
         }
 
-        *(op->elem) = prio();
+        bool use_tail = prio_use_tail();
+        *(op->elem) = std::move(prio());
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
         if (op->metainfo) {
             *(op->metainfo) = std::move(prio_metainfo());
         }
 #endif
         op->status.store(SUCCEEDED, std::memory_order_release);
-        prio_pop();
+        prio_pop(use_tail);
 
     }
 
     // pops the highest-priority item, saves copy
     void internal_reserve(prio_operation *op) override {
-        if (this->my_reserved == true || this->my_tail == 0) {
+        // The items of move-only types cannot be reserved
+        if (this->my_reserved == true || this->my_tail == 0 || !std::is_copy_assignable<T>::value) {
             op->status.store(FAILED, std::memory_order_release);
             return;
         }
         this->my_reserved = true;
-        *(op->elem) = prio();
+        bool use_tail = prio_use_tail();
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
         if (op->metainfo) {
             *(op->metainfo) = std::move(prio_metainfo());
             reserved_metainfo = *(op->metainfo);
         }
 #endif
-        reserved_item = *(op->elem);
+        reserved_item = std::move(prio());
+        copy_item(*(op->elem), reserved_item, std::is_copy_assignable<T>());
         op->status.store(SUCCEEDED, std::memory_order_release);
-        prio_pop();
+        prio_pop(use_tail);
     }
 
     void internal_consume(prio_operation *op) override {
@@ -1994,7 +2680,7 @@ protected:
 
     void internal_release(prio_operation *op) override {
         op->status.store(SUCCEEDED, std::memory_order_release);
-        prio_push(reserved_item __TBB_FLOW_GRAPH_METAINFO_ARG(reserved_metainfo));
+        prio_push(std::move(reserved_item) __TBB_FLOW_GRAPH_METAINFO_ARG(reserved_metainfo));
         this->my_reserved = false;
         reserved_item = input_type();
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
@@ -2019,13 +2705,19 @@ private:
     }
 
     void try_put_and_add_task(graph_task*& last_task) {
+        bool use_tail = prio_use_tail();
+#if __TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES
+        graph_task* new_task = this->my_successors.try_put_task_move(std::move(this->prio())
+                                                                     __TBB_FLOW_GRAPH_METAINFO_ARG(this->prio_metainfo()));
+#else
         graph_task* new_task = this->my_successors.try_put_task(this->prio()
                                                                 __TBB_FLOW_GRAPH_METAINFO_ARG(this->prio_metainfo()));
+#endif
         if (new_task) {
             // workaround for icc bug
             graph& graph_ref = this->graph_reference();
             last_task = combine_tasks(graph_ref, last_task, new_task);
-            prio_pop();
+            prio_pop(use_tail);
         }
     }
 
@@ -2045,10 +2737,11 @@ private:
     }
 
     // prio_push: checks that the item will fit, expand array if necessary, put at end
-    void prio_push(const T &src __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo)) {
+    template <typename Item>
+    void prio_push(Item&& src __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo)) {
         if ( this->my_tail >= this->my_array_size )
             this->grow_my_array( this->my_tail + 1 );
-        (void) this->place_item(this->my_tail, src __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
+        (void) this->place_item(this->my_tail, std::forward<Item>(src) __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
         ++(this->my_tail);
         __TBB_ASSERT(mark < this->my_tail, "mark outside bounds after push");
     }
@@ -2056,8 +2749,9 @@ private:
     // prio_pop: deletes highest priority item from the array, and if it is item
     // 0, move last item to 0 and reheap.  If end of array, just destroy and decrement tail
     // and mark.  Assumes the array has already been tested for emptiness; no failure.
-    void prio_pop()  {
-        if (prio_use_tail()) {
+    // The item may be moved from, so whether it is the last one is checked before that
+    void prio_pop(bool use_tail)  {
+        if (use_tail) {
             // there are newly pushed elements; last one higher than top
             // copy the data
             this->destroy_item(this->my_tail-1);
@@ -2078,10 +2772,13 @@ private:
         __TBB_ASSERT(mark <= this->my_tail, "mark outside bounds after pop");
     }
 
-    const T& prio() {
+    T& prio() {
         return this->get_my_item(prio_use_tail() ? this->my_tail-1 : 0);
     }
 
+    static void copy_item(T& to, const T& from, /*copyable=*/std::true_type) { to = from; }
+    static void copy_item(T&, const T&, /*copyable=*/std::false_type) {}
+
 #if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
     message_metainfo& prio_metainfo() {
         return this->get_my_metainfo(prio_use_tail() ? this->my_tail-1 : 0);
@@ -2109,7 +2806,7 @@ private:
                 this->move_item(cur_pos, parent);
                 cur_pos = parent;
             } while( cur_pos );
-            this->place_item(cur_pos, to_place __TBB_FLOW_GRAPH_METAINFO_ARG(std::move(metainfo)));
+            this->place_item(cur_pos, std::move(to_place) __TBB_FLOW_GRAPH_METAINFO_ARG(std::move(metainfo)));
         }
     }
 
@@ -2159,6 +2856,11 @@ private:
     //! The internal receiver< DecrementType > that adjusts the count
     threshold_regulator< limiter_node<T, DecrementType>, DecrementType > decrement;
 
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    //! The queue size is the number of messages passed and not yet decremented
+    node_statistics my_statistics;
+#endif
+
     graph_task* decrement_counter( long long delta ) {
         if ( delta > 0 && size_t(delta) > my_threshold ) {
             delta = my_threshold;
@@ -2218,6 +2920,10 @@ private:
                 {
                     spin_mutex::scoped_lock lock(my_mutex);
                     ++my_count;
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+                    my_statistics.record_put(true);
+                    my_statistics.record_queue_size(my_count);
+#endif
                     if ( my_future_decrement ) {
                         if ( my_count > my_future_decrement ) {
                             my_count -= my_future_decrement;
@@ -2268,6 +2974,9 @@ private:
             static_cast<receiver<input_type> *>(this), static_cast<receiver<DecrementType> *>(&decrement),
             static_cast<sender<output_type> *>(this)
         );
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        my_successors.set_statistics(&my_statistics);
+#endif
     }
 
 public:
@@ -2275,6 +2984,9 @@ public:
     limiter_node(graph &g, size_t threshold)
         : graph_node(g), my_threshold(threshold), my_count(0), my_tries(0), my_future_decrement(0),
         my_predecessors(this), my_successors(this), decrement(this)
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+        , my_statistics(threshold)
+#endif
     {
         initialize();
     }
@@ -2293,6 +3005,11 @@ public:
     //! The interface for accessing internal receiver< DecrementType > that adjusts the count
     receiver<DecrementType>& decrementer() { return decrement; }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    node_statistics& statistics() { return my_statistics; }
+    const node_statistics& statistics() const { return my_statistics; }
+#endif
+
     //! Replace the current successor with this new successor
     bool register_successor( successor_type &r ) override {
         spin_mutex::scoped_lock lock(my_mutex);
@@ -2349,8 +3066,12 @@ private:
     graph_task* try_put_task_impl( const T &t __TBB_FLOW_GRAPH_METAINFO_ARG(const message_metainfo& metainfo) ) {
         {
             spin_mutex::scoped_lock lock(my_mutex);
-            if ( my_count + my_tries >= my_threshold )
+            if ( my_count + my_tries >= my_threshold ) {
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+                my_statistics.record_put(false);
+#endif
                 return nullptr;
+            }
             else
                 ++my_tries;
         }
@@ -2358,6 +3079,9 @@ private:
         graph_task* rtask = my_successors.try_put_task(t __TBB_FLOW_GRAPH_METAINFO_ARG(metainfo));
         if ( !rtask ) {  // try_put_task failed.
             spin_mutex::scoped_lock lock(my_mutex);
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+            my_statistics.record_put(false);
+#endif
             --my_tries;
             if (check_conditions() && is_graph_active(this->my_graph)) {
                 d1::small_object_allocator allocator{};
@@ -2368,6 +3092,10 @@ private:
         else {
             spin_mutex::scoped_lock lock(my_mutex);
             ++my_count;
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+            my_statistics.record_put(true);
+            my_statistics.record_queue_size(my_count);
+#endif
             if ( my_future_decrement ) {
                 if ( my_count > my_future_decrement ) {
                     my_count -= my_future_decrement;
@@ -2406,6 +3134,16 @@ protected:
         }
         decrement.reset_receiver(f);
     }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    void describe(node_description& d) override {
+        d.type = FLOW_LIMITER_NODE;
+        d.statistics = &my_statistics;
+        d.add_input<input_type>(*this);
+        d.add_input<DecrementType>(decrement);
+        d.add_output(my_successors);
+    }
+#endif
 };  // limiter_node
 
 #include "detail/_flow_graph_join_impl.h"
@@ -3285,6 +4023,13 @@ protected:
     void reset_node( reset_flags f) override {
        base_type::reset_node(f);
     }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    void describe(node_description& d) override {
+        base_type::describe(d);
+        d.type = FLOW_ASYNC_NODE;
+    }
+#endif
 };
 
 #include "detail/_flow_graph_node_set_impl.h"
@@ -3505,6 +4250,15 @@ protected:
            my_successors.clear();
        }
     }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+protected:
+    void describe(node_description& d) override {
+        d.type = FLOW_OVERWRITE_NODE;
+        d.add_input<input_type>(*this);
+        d.add_output(my_successors);
+    }
+#endif
 };  // overwrite_node
 
 template< typename T >
@@ -3552,6 +4306,13 @@ protected:
         return this->my_buffer_is_valid ? nullptr : this->try_put_task_impl(v, metainfo);
     }
 #endif
+
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    void describe(node_description& d) override {
+        base_type::describe(d);
+        d.type = FLOW_WRITE_ONCE_NODE;
+    }
+#endif
 }; // write_once_node
 
 inline void set_name(const graph& g, const char *name) {
@@ -3699,6 +4460,25 @@ inline namespace v1 {
     using detail::d2::node_priority_t;
     using detail::d2::no_priority;
 
+#if __TBB_PREVIEW_FLOW_GRAPH_BATCHING
+    using detail::d2::batch_function_node;
+    using detail::d2::batch_multifunction_node;
+#endif
+
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION
+    using detail::d2::fuse_serial_chains;
+#endif
+
+#if __TBB_PREVIEW_FLOW_GRAPH_STATISTICS
+    using detail::d2::node_statistics;
+    using detail::d2::graph_to_dot;
+#endif
+
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_ARENAS
+    using detail::d2::bind_to_arena;
+    using detail::d2::unbind_from_arena;
+#endif
+
 #if __TBB_PREVIEW_FLOW_GRAPH_NODE_SET
     using detail::d2::follows;
     using detail::d2::precedes;
@@ -0,0 +1,358 @@
+/*
+    Copyright (c) 2025 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef __TBB_mapped_file_range_H
+#define __TBB_mapped_file_range_H
+
+#if ! TBB_PREVIEW_MAPPED_FILE_RANGE
+    #error Set TBB_PREVIEW_MAPPED_FILE_RANGE to include mapped_file_range.h
+#endif
+
+#include "detail/_config.h"
+#include "detail/_namespace_injection.h"
+#include "detail/_assert.h"
+#include "detail/_range_common.h"
+#include "detail/_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#if _WIN32 || _WIN64
+#ifndef NOMINMAX
+#define NOMINMAX
+#define __TBB_DEFINED_NOMINMAX 1
+#endif
+#include <windows.h>
+#if __TBB_DEFINED_NOMINMAX
+#undef NOMINMAX
+#undef __TBB_DEFINED_NOMINMAX
+#endif
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace tbb {
+namespace detail {
+namespace d1 {
+
+//! Expected access pattern of a part of a mapped file
+enum class file_access_hint {
+    normal,
+    //! The pages are read in ascending order
+    sequential,
+    //! The pages are read in no particular order
+    random,
+    //! The pages will be read soon and may be read ahead
+    willneed,
+    //! The pages will not be read soon
+    dontneed
+};
+
+//! Passes the hint for the pages that hold [first, last) to the operating system
+/** The hints are ignored on the systems that do not support them. **/
+inline void advise_file_pages(const char* first, const char* last, file_access_hint hint) {
+#if _WIN32 || _WIN64
+    suppress_unused_warning(first, last, hint);
+#else
+    if (first == last) {
+        return;
+    }
+    std::uintptr_t page_size = static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+    std::uintptr_t start = reinterpret_cast<std::uintptr_t>(first) & ~(page_size - 1);
+    int advice = POSIX_MADV_NORMAL;
+    switch (hint) {
+    case file_access_hint::sequential: advice = POSIX_MADV_SEQUENTIAL; break;
+    case file_access_hint::random: advice = POSIX_MADV_RANDOM; break;
+    case file_access_hint::willneed: advice = POSIX_MADV_WILLNEED; break;
+    case file_access_hint::dontneed: advice = POSIX_MADV_DONTNEED; break;
+    default: break;
+    }
+    posix_madvise(reinterpret_cast<void*>(start), reinterpret_cast<std::uintptr_t>(last) - start, advice);
+#endif
+}
+
+//! Read-only mapping of a whole file into memory
+/** Like std::ifstream, the file is left closed if it cannot be opened or mapped. **/
+class mapped_file : no_copy {
+public:
+    mapped_file() = default;
+    explicit mapped_file(const char* path) { open(path); }
+    explicit mapped_file(const std::string& path) { open(path.c_str()); }
+
+    mapped_file(mapped_file&& other) noexcept { swap(other); }
+    mapped_file& operator=(mapped_file&& other) noexcept {
+        if (this != &other) {
+            close();
+            swap(other);
+        }
+        return *this;
+    }
+
+    ~mapped_file() { close(); }
+
+    //! Maps the file; returns false if the file cannot be opened or mapped
+    bool open(const char* path) {
+        close();
+#if _WIN32 || _WIN64
+        my_file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (my_file == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(my_file, &size)) {
+            close();
+            return false;
+        }
+        my_size = static_cast<std::size_t>(size.QuadPart);
+        if (my_size > 0) {
+            my_mapping = CreateFileMappingA(my_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (my_mapping == nullptr) {
+                close();
+                return false;
+            }
+            my_data = static_cast<const char*>(MapViewOfFile(my_mapping, FILE_MAP_READ, 0, 0, 0));
+            if (my_data == nullptr) {
+                close();
+                return false;
+            }
+        }
+#else
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            ::close(fd);
+            return false;
+        }
+        my_size = static_cast<std::size_t>(st.st_size);
+        if (my_size > 0) {
+            void* data = mmap(nullptr, my_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) {
+                ::close(fd);
+                my_size = 0;
+                return false;
+            }
+            my_data = static_cast<const char*>(data);
+        }
+        // The mapping stays valid after the descriptor is closed
+        ::close(fd);
+#endif
+        my_open = true;
+        return true;
+    }
+
+    bool open(const std::string& path) { return open(path.c_str()); }
+
+    void close() {
+#if _WIN32 || _WIN64
+        if (my_data) {
+            UnmapViewOfFile(my_data);
+        }
+        if (my_mapping) {
+            CloseHandle(my_mapping);
+        }
+        if (my_file != INVALID_HANDLE_VALUE) {
+            CloseHandle(my_file);
+        }
+        my_mapping = nullptr;
+        my_file = INVALID_HANDLE_VALUE;
+#else
+        if (my_data) {
+            munmap(const_cast<char*>(my_data), my_size);
+        }
+#endif
+        my_data = nullptr;
+        my_size = 0;
+        my_open = false;
+    }
+
+    bool is_open() const { return my_open; }
+
+    const char* data() const { return my_data; }
+    std::size_t size() const { return my_size; }
+    const char* begin() const { return my_data; }
+    const char* end() const { return my_data + my_size; }
+
+    void advise(file_access_hint hint) const {
+        advise_file_pages(begin(), end(), hint);
+    }
+
+private:
+    void swap(mapped_file& other) noexcept {
+        std::swap(my_data, other.my_data);
+        std::swap(my_size, other.my_size);
+        std::swap(my_open, other.my_open);
+#if _WIN32 || _WIN64
+        std::swap(my_file, other.my_file);
+        std::swap(my_mapping, other.my_mapping);
+#endif
+    }
+
+    const char* my_data{nullptr};
+    std::size_t my_size{0};
+    bool my_open{false};
+#if _WIN32 || _WIN64
+    HANDLE my_file{INVALID_HANDLE_VALUE};
+    HANDLE my_mapping{nullptr};
+#endif
+};
+
+//! Range of whole records of a text in memory, such as a mapped file
+/** A record ends with the delimiter, except possibly the last record of the text. Every subrange
+    consists of whole records: it is split after the delimiter nearest to the split point.
+    The range is not divisible if it is not larger than the grain size or holds one record only.
+    @ingroup algorithms **/
+class mapped_file_range {
+public:
+    using const_iterator = const char*;
+    using size_type = std::size_t;
+
+    static constexpr bool is_splittable_in_proportion = true;
+
+    mapped_file_range(const char* first, const char* last, size_type grainsize = default_grainsize,
+                      char delimiter = '\n')
+        : my_begin(first), my_end(last), my_grainsize(grainsize), my_delimiter(delimiter)
+    {
+        __TBB_ASSERT(my_begin <= my_end, "range with negative size");
+        __TBB_ASSERT(my_grainsize > 0, "grainsize must be positive");
+        my_split = find_split(my_begin + size() / 2);
+    }
+
+    explicit mapped_file_range(const mapped_file& file, size_type grainsize = default_grainsize,
+                               char delimiter = '\n')
+        : mapped_file_range(file.begin(), file.end(), grainsize, delimiter) {}
+
+    //! Splitting constructor: takes the records after the split point
+    mapped_file_range(mapped_file_range& r, split)
+        : mapped_file_range(r, r.my_split) {}
+
+    mapped_file_range(mapped_file_range& r, proportional_split& proportion)
+        : mapped_file_range(r, r.proportional_split_point(proportion)) {}
+
+    const_iterator begin() const { return my_begin; }
+    const_iterator end() const { return my_end; }
+    size_type size() const { return size_type(my_end - my_begin); }
+    bool empty() const { return my_begin == my_end; }
+    size_type grainsize() const { return my_grainsize; }
+    char delimiter() const { return my_delimiter; }
+
+    bool is_divisible() const { return my_split != nullptr; }
+
+    //! Removes and returns the leading records that take at least n bytes
+    /** Serves as the input of parallel_pipeline that passes the text in chunks of about n bytes. **/
+    mapped_file_range take_front(size_type n) {
+        const char* last = my_end;
+        if (n < size()) {
+            const char* found = find_delimiter(my_begin + (n > 0 ? n - 1 : 0), my_end);
+            last = found ? found + 1 : my_end;
+        }
+        mapped_file_range front(my_begin, last, my_grainsize, my_delimiter);
+        my_begin = last;
+        my_split = find_split(my_begin + size() / 2);
+        return front;
+    }
+
+    //! Calls f(first, last) for each record; the delimiter is not included into [first, last)
+    template <typename F>
+    void for_each_record(F&& f) const {
+        const char* first = my_begin;
+        while (first != my_end) {
+            const char* found = find_delimiter(first, my_end);
+            if (!found) {
+                f(first, my_end);
+                return;
+            }
+            f(first, found);
+            first = found + 1;
+        }
+    }
+
+    //! Passes the hint for the pages of the range to the operating system
+    void advise(file_access_hint hint) const {
+        advise_file_pages(my_begin, my_end, hint);
+    }
+
+    static constexpr size_type default_grainsize = 64 * 1024;
+
+private:
+    mapped_file_range(mapped_file_range& r, const char* point)
+        : my_begin(point), my_end(r.my_end), my_grainsize(r.my_grainsize), my_delimiter(r.my_delimiter)
+    {
+        __TBB_ASSERT(r.is_divisible(), "can't split not divisible range");
+        __TBB_ASSERT(r.my_begin < point && point < r.my_end, "the split point is out of the range");
+        r.my_end = point;
+        r.my_split = r.find_split(r.my_begin + r.size() / 2);
+        my_split = find_split(my_begin + size() / 2);
+    }
+
+    const char* find_delimiter(const char* first, const char* last) const {
+        return static_cast<const char*>(std::memchr(first, my_delimiter, size_type(last - first)));
+    }
+
+    //! Returns the start of the record nearest to target that is neither the first nor past the end
+    const char* find_split(const char* target) const {
+        if (size() <= my_grainsize) {
+            return nullptr;
+        }
+        // A delimiter in [target, end - 1) ends the record before a non-empty remainder
+        const char* found = find_delimiter(target, my_end - 1);
+        if (found) {
+            return found + 1;
+        }
+        for (const char* p = target; p != my_begin; ) {
+            if (*--p == my_delimiter) {
+                return p + 1;
+            }
+        }
+        return nullptr;
+    }
+
+    const char* proportional_split_point(proportional_split& proportion) const {
+        __TBB_ASSERT(is_divisible(), "can't split not divisible range");
+        size_type left = size() * proportion.left() / (proportion.left() + proportion.right());
+        const char* point = find_split(my_begin + (left > 0 ? left : 1));
+        return point ? point : my_split;
+    }
+
+    const char* my_begin;
+    const char* my_end;
+    //! The start of the second half for the next split, or nullptr if the range is not divisible
+    const char* my_split;
+    size_type my_grainsize;
+    char my_delimiter;
+};
+
+} // namespace d1
+} // namespace detail
+
+inline namespace v1 {
+using detail::d1::file_access_hint;
+using detail::d1::mapped_file;
+using detail::d1::mapped_file_range;
+} // namespace v1
+
+} // namespace tbb
+
+#endif /* __TBB_mapped_file_range_H */
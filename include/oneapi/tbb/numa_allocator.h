@@ -0,0 +1,301 @@
+/*
+    Copyright (c) 2025 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef __TBB_numa_allocator_H
+#define __TBB_numa_allocator_H
+
+#if ! TBB_PREVIEW_NUMA_ALLOCATOR
+    #error Set TBB_PREVIEW_NUMA_ALLOCATOR to include numa_allocator.h
+#endif
+
+#include "detail/_config.h"
+#include "detail/_namespace_injection.h"
+#include "detail/_exception.h"
+#include "detail/_template_helpers.h"
+#include "detail/_utils.h"
+
+#include "blocked_range.h"
+#include "partitioner.h"
+#include "parallel_for.h"
+#include "spin_mutex.h"
+#include "task_arena.h"
+#include "task_group.h"
+
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if _WIN32 || _WIN64
+#ifndef NOMINMAX
+#define NOMINMAX
+#define __TBB_DEFINED_NOMINMAX 1
+#endif
+#include <windows.h>
+#if __TBB_DEFINED_NOMINMAX
+#undef NOMINMAX
+#undef __TBB_DEFINED_NOMINMAX
+#endif
+#else
+#include <sys/mman.h>
+#endif
+
+namespace tbb {
+namespace detail {
+namespace d1 {
+
+//! Maps zero-filled pages that are placed on a NUMA node when they are first touched
+inline void* allocate_untouched_pages(std::size_t bytes) {
+    bytes = bytes ? bytes : 1;
+#if _WIN32 || _WIN64
+    return VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+    void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return p == MAP_FAILED ? nullptr : p;
+#endif
+}
+
+inline void deallocate_untouched_pages(void* p, std::size_t bytes) {
+#if _WIN32 || _WIN64
+    suppress_unused_warning(bytes);
+    VirtualFree(p, 0, MEM_RELEASE);
+#else
+    munmap(p, bytes ? bytes : 1);
+#endif
+}
+
+//! Allocator that leaves the placement of the pages to the threads that initialize the elements
+/** Operating systems usually place a page on the NUMA node of the thread that touches it first.
+    Every allocation takes whole pages of its own, mapped from the operating system and not touched
+    by the allocator, so it is meant for large buffers. Construction without arguments
+    default-initializes the elements, so a container of trivially default constructible elements
+    stays untouched until it is initialized with parallel_first_touch.
+    @ingroup memory_allocation **/
+template <typename T>
+class numa_allocator {
+public:
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal = std::true_type;
+
+    numa_allocator() = default;
+    template <typename U> numa_allocator(const numa_allocator<U>&) noexcept {}
+
+    __TBB_nodiscard T* allocate(std::size_t n) {
+        void* p = n <= max_size() ? allocate_untouched_pages(n * sizeof(value_type)) : nullptr;
+        if (!p) {
+            throw_exception(exception_id::bad_alloc);
+        }
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, std::size_t n) {
+        deallocate_untouched_pages(p, n * sizeof(value_type));
+    }
+
+    std::size_t max_size() const noexcept {
+        return ~std::size_t(0) / sizeof(value_type);
+    }
+
+    //! Default-initializes the object instead of value-initializing it
+    template <typename U>
+    void construct(U* p) noexcept(std::is_nothrow_default_constructible<U>::value) {
+        ::new (static_cast<void*>(p)) U;
+    }
+
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args) {
+        ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const numa_allocator<T>&, const numa_allocator<U>&) noexcept { return true; }
+
+#if !__TBB_CPP20_COMPARISONS_PRESENT
+template <typename T, typename U>
+bool operator!=(const numa_allocator<T>&, const numa_allocator<U>&) noexcept { return false; }
+#endif
+
+//! The subranges constructed by parallel_first_touch, destroyed if another subrange throws
+template <typename T>
+class first_touch_log : no_copy {
+public:
+    void record(const blocked_range<std::size_t>& r) {
+        spin_mutex::scoped_lock lock(my_mutex);
+        my_ranges.push_back(r);
+    }
+
+    void destroy(T* data) {
+        for (const blocked_range<std::size_t>& r : my_ranges) {
+            for (std::size_t i = r.begin(); i != r.end(); ++i) {
+                data[i].~T();
+            }
+        }
+        my_ranges.clear();
+    }
+
+private:
+    spin_mutex my_mutex;
+    std::vector<blocked_range<std::size_t>> my_ranges;
+};
+
+template <typename T, typename... Args>
+struct first_touch_body {
+    //! The constructed elements need to be destroyed only if a construction may throw
+    using needs_log = std::integral_constant<bool, !std::is_nothrow_constructible<T, const Args&...>::value &&
+                                                   !std::is_trivially_destructible<T>::value>;
+
+    T* my_data;
+    first_touch_log<T>* my_log;
+    std::tuple<const Args&...> my_args;
+
+    void operator()(const blocked_range<std::size_t>& r) const {
+        std::size_t i = r.begin();
+        try_call([&] {
+            for (; i != r.end(); ++i) {
+                construct(my_data + i, make_index_sequence<sizeof...(Args)>());
+            }
+        }).on_exception([&] {
+            for (std::size_t j = r.begin(); j != i; ++j) {
+                my_data[j].~T();
+            }
+        });
+        record(r, needs_log());
+    }
+
+    template <std::size_t... Is>
+    void construct(T* p, index_sequence<Is...>) const {
+        ::new (static_cast<void*>(p)) T(std::get<Is>(my_args)...);
+    }
+
+    void record(const blocked_range<std::size_t>& r, std::true_type) const { my_log->record(r); }
+    void record(const blocked_range<std::size_t>&, std::false_type) const {}
+};
+
+template <typename T, typename Partitioner, typename... Args>
+void parallel_first_touch_impl(T* data, const blocked_range<std::size_t>& range, Partitioner& partitioner,
+                               const Args&... args)
+{
+    first_touch_log<T> log;
+    try_call([&] {
+        parallel_for(range, first_touch_body<T, Args...>{data, &log, std::tuple<const Args&...>(args...)},
+                     partitioner);
+    }).on_exception([&] {
+        log.destroy(data);
+    });
+}
+
+//! Constructs data[i] from args for every i of the range by the thread that will process it
+/** A loop over the same range with a static_partitioner in the same arena assigns every subrange
+    to the same thread, so the pages of the elements are placed on the NUMA node of that thread.
+    Pages that hold the elements of two subranges are placed by one of the threads. If a
+    construction throws, the constructed elements are destroyed. **/
+template <typename T, typename... Args>
+void parallel_first_touch(T* data, const blocked_range<std::size_t>& range, const static_partitioner& partitioner,
+                          const Args&... args)
+{
+    parallel_first_touch_impl(data, range, partitioner, args...);
+}
+
+//! Constructs data[i] from args for every i of the range and records the placement in the partitioner
+/** The loops that use the same affinity_partitioner object replay the distribution of the range. **/
+template <typename T, typename... Args>
+void parallel_first_touch(T* data, const blocked_range<std::size_t>& range, affinity_partitioner& partitioner,
+                          const Args&... args)
+{
+    parallel_first_touch_impl(data, range, partitioner, args...);
+}
+
+//! Constructs data[0], ..., data[n - 1] as a loop over blocked_range<std::size_t>(0, n) would process them
+template <typename T, typename... Args>
+void parallel_first_touch(T* data, std::size_t n, const static_partitioner& partitioner, const Args&... args) {
+    parallel_first_touch(data, blocked_range<std::size_t>(0, n), partitioner, args...);
+}
+
+template <typename T, typename... Args>
+void parallel_first_touch(T* data, std::size_t n, affinity_partitioner& partitioner, const Args&... args) {
+    parallel_first_touch(data, blocked_range<std::size_t>(0, n), partitioner, args...);
+}
+
+//! The part of [0, n) that parallel_first_touch gives to the arena with the index of num_arenas arenas
+inline blocked_range<std::size_t> arena_share(std::size_t n, std::size_t index, std::size_t num_arenas) {
+    __TBB_ASSERT(index < num_arenas, "the index of the arena is out of range");
+    std::size_t base = n / num_arenas;
+    std::size_t extra = n % num_arenas;
+    std::size_t first = index * base + (index < extra ? index : extra);
+    return blocked_range<std::size_t>(first, first + base + (index < extra ? 1 : 0));
+}
+
+//! Constructs data[0], ..., data[n - 1] from args, the share of every arena by its own threads
+/** Every arena, such as the arena of a NUMA node, constructs its arena_share of the elements
+    with a static_partitioner, so the pages are placed on its node. The loops that process the share
+    of every arena in that arena with a static_partitioner then find their elements local. **/
+template <typename T, typename... Args>
+void parallel_first_touch(T* data, std::size_t n, std::vector<task_arena>& arenas, const Args&... args) {
+    const std::size_t num_arenas = arenas.size();
+    first_touch_log<T> log;
+    first_touch_body<T, Args...> body{data, &log, std::tuple<const Args&...>(args...)};
+    std::vector<task_group> groups(num_arenas);
+    for (std::size_t i = 0; i < num_arenas; ++i) {
+        arenas[i].execute([&, i] {
+            groups[i].run([&, i] {
+                parallel_for(arena_share(n, i, num_arenas), body, static_partitioner());
+            });
+        });
+    }
+    // Every arena completes its share before the constructed elements can be destroyed
+#if TBB_USE_EXCEPTIONS
+    std::exception_ptr error;
+#endif
+    for (std::size_t i = 0; i < num_arenas; ++i) {
+#if TBB_USE_EXCEPTIONS
+        try
+#endif
+        {
+            arenas[i].execute([&, i] { groups[i].wait(); });
+        }
+#if TBB_USE_EXCEPTIONS
+        catch (...) {
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+#endif
+    }
+#if TBB_USE_EXCEPTIONS
+    if (error) {
+        log.destroy(data);
+        std::rethrow_exception(error);
+    }
+#endif
+}
+
+} // namespace d1
+} // namespace detail
+
+inline namespace v1 {
+using detail::d1::numa_allocator;
+using detail::d1::parallel_first_touch;
+using detail::d1::arena_share;
+} // namespace v1
+
+} // namespace tbb
+
+#endif /* __TBB_numa_allocator_H */
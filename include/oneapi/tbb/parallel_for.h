@@ -55,6 +55,44 @@ concept parallel_for_function = std::invocable<const std::remove_reference_t<Fun
 #endif // __TBB_CPP20_CONCEPTS_PRESENT
 namespace d1 {
 
+#if __TBB_PREVIEW_PREALLOCATED_TASK_TREE
+//! Leaf task of parallel_for with static_partitioner, placed in a static_task_tree
+/** @ingroup algorithms */
+template<typename Range, typename Body>
+struct static_tree_for : public task {
+    using tree_type = static_task_tree<static_tree_for>;
+
+    Range my_range;
+    //! Every leaf calls its own copy of the body, as start_for does
+    const Body my_body;
+    tree_type& my_tree;
+
+    static_tree_for( const Range& range, const Body& body, tree_type& tree ) :
+        my_range(range), my_body(body), my_tree(tree) {}
+
+    task* execute(execution_data& ed) override {
+        if (this == &my_tree[0]) {
+            my_tree.spawn_leaves(my_range, [this]( const Range& r ) -> static_tree_for& {
+                return my_tree.emplace(r, my_body, my_tree);
+            }, *context(ed));
+        }
+        tbb::detail::invoke(my_body, my_range);
+        my_tree.release();
+        return nullptr;
+    }
+    task* cancel(execution_data&) override {
+        my_tree.release();
+        return nullptr;
+    }
+
+    static void run(const Range& range, const Body& body, task_group_context& context) {
+        tree_type tree(static_task_tree_capacity());
+        static_tree_for& root = tree.emplace(range, body, tree);
+        execute_and_wait(root, context, tree.wait(), context);
+    }
+};
+#endif // __TBB_PREVIEW_PREALLOCATED_TASK_TREE
+
 //! Task type used in parallel_for
 /** @ingroup algorithms */
 template<typename Range, typename Body, typename Partitioner>
@@ -103,6 +141,12 @@ struct start_for : public task {
 
     static void run(const Range& range, const Body& body, Partitioner& partitioner, task_group_context& context) {
         if ( !range.empty() ) {
+#if __TBB_PREVIEW_PREALLOCATED_TASK_TREE
+            if ( std::is_same<typename std::remove_const<Partitioner>::type, static_partitioner>::value ) {
+                static_tree_for<Range, Body>::run(range, body, context);
+                return;
+            }
+#endif
             small_object_allocator alloc{};
             start_for& for_task = *alloc.new_object<start_for>(range, body, partitioner, alloc);
 
@@ -261,6 +305,26 @@ void parallel_for( const Range& range, const Body& body, affinity_partitioner& p
     start_for<Range,Body,affinity_partitioner>::run(range,body,partitioner);
 }
 
+#if __TBB_PREVIEW_TUNING_PARTITIONER
+//! Parallel iteration over range with tuning_partitioner.
+/** @ingroup algorithms **/
+template<typename Range, typename Body>
+    __TBB_requires(tbb_range<Range> && parallel_for_body<Body, Range>)
+void parallel_for( const Range& range, const Body& body, tuning_partitioner& partitioner ) {
+    start_for<Range,Body,tuning_partitioner>::run(range,body,partitioner);
+}
+#endif
+
+#if __TBB_PREVIEW_BANDWIDTH_PARTITIONER
+//! Parallel iteration over range with bandwidth_partitioner.
+/** @ingroup algorithms **/
+template<typename Range, typename Body>
+    __TBB_requires(tbb_range<Range> && parallel_for_body<Body, Range>)
+void parallel_for( const Range& range, const Body& body, bandwidth_partitioner& partitioner ) {
+    start_for<Range,Body,bandwidth_partitioner>::run(range,body,partitioner);
+}
+#endif
+
 //! Parallel iteration over range with default partitioner and user-supplied context.
 /** @ingroup algorithms **/
 template<typename Range, typename Body>
@@ -301,6 +365,26 @@ void parallel_for( const Range& range, const Body& body, affinity_partitioner& p
     start_for<Range,Body,affinity_partitioner>::run(range,body,partitioner, context);
 }
 
+#if __TBB_PREVIEW_TUNING_PARTITIONER
+//! Parallel iteration over range with tuning_partitioner and user-supplied context.
+/** @ingroup algorithms **/
+template<typename Range, typename Body>
+    __TBB_requires(tbb_range<Range> && parallel_for_body<Body, Range>)
+void parallel_for( const Range& range, const Body& body, tuning_partitioner& partitioner, task_group_context& context ) {
+    start_for<Range,Body,tuning_partitioner>::run(range,body,partitioner, context);
+}
+#endif
+
+#if __TBB_PREVIEW_BANDWIDTH_PARTITIONER
+//! Parallel iteration over range with bandwidth_partitioner and user-supplied context.
+/** @ingroup algorithms **/
+template<typename Range, typename Body>
+    __TBB_requires(tbb_range<Range> && parallel_for_body<Body, Range>)
+void parallel_for( const Range& range, const Body& body, bandwidth_partitioner& partitioner, task_group_context& context ) {
+    start_for<Range,Body,bandwidth_partitioner>::run(range,body,partitioner, context);
+}
+#endif
+
 //! Implementation of parallel iteration over stepped range of integers with explicit step and partitioner
 template <typename Index, typename Function, typename Partitioner>
 void parallel_for_impl(Index first, Index last, Index step, const Function& f, Partitioner& partitioner) {
@@ -346,6 +430,24 @@ void parallel_for(Index first, Index last, Index step, const Function& f, affini
     parallel_for_impl(first, last, step, f, partitioner);
 }
 
+#if __TBB_PREVIEW_TUNING_PARTITIONER
+//! Parallel iteration over a range of integers with a step provided and affinity partitioner
+template <typename Index, typename Function>
+    __TBB_requires(parallel_for_index<Index> && parallel_for_function<Function, Index>)
+void parallel_for(Index first, Index last, Index step, const Function& f, tuning_partitioner& partitioner) {
+    parallel_for_impl(first, last, step, f, partitioner);
+}
+#endif
+
+#if __TBB_PREVIEW_BANDWIDTH_PARTITIONER
+//! Parallel iteration over a range of integers with a step provided and bandwidth_partitioner
+template <typename Index, typename Function>
+    __TBB_requires(parallel_for_index<Index> && parallel_for_function<Function, Index>)
+void parallel_for(Index first, Index last, Index step, const Function& f, bandwidth_partitioner& partitioner) {
+    parallel_for_impl(first, last, step, f, partitioner);
+}
+#endif
+
 //! Parallel iteration over a range of integers with a default step value and default partitioner
 template <typename Index, typename Function>
     __TBB_requires(parallel_for_index<Index> && parallel_for_function<Function, Index>)
@@ -377,6 +479,24 @@ void parallel_for(Index first, Index last, const Function& f, affinity_partition
     parallel_for_impl(first, last, static_cast<Index>(1), f, partitioner);
 }
 
+#if __TBB_PREVIEW_TUNING_PARTITIONER
+//! Parallel iteration over a range of integers with a default step value and affinity partitioner
+template <typename Index, typename Function>
+    __TBB_requires(parallel_for_index<Index> && parallel_for_function<Function, Index>)
+void parallel_for(Index first, Index last, const Function& f, tuning_partitioner& partitioner) {
+    parallel_for_impl(first, last, static_cast<Index>(1), f, partitioner);
+}
+#endif
+
+#if __TBB_PREVIEW_BANDWIDTH_PARTITIONER
+//! Parallel iteration over a range of integers with a default step value and bandwidth_partitioner
+template <typename Index, typename Function>
+    __TBB_requires(parallel_for_index<Index> && parallel_for_function<Function, Index>)
+void parallel_for(Index first, Index last, const Function& f, bandwidth_partitioner& partitioner) {
+    parallel_for_impl(first, last, static_cast<Index>(1), f, partitioner);
+}
+#endif
+
 //! Implementation of parallel iteration over stepped range of integers with explicit step, task group context, and partitioner
 template <typename Index, typename Function, typename Partitioner>
 void parallel_for_impl(Index first, Index last, Index step, const Function& f, Partitioner& partitioner, task_group_context &context) {
@@ -422,6 +542,24 @@ void parallel_for(Index first, Index last, Index step, const Function& f, affini
     parallel_for_impl(first, last, step, f, partitioner, context);
 }
 
+#if __TBB_PREVIEW_TUNING_PARTITIONER
+//! Parallel iteration over a range of integers with explicit step, task group context, and affinity partitioner
+template <typename Index, typename Function>
+    __TBB_requires(parallel_for_index<Index> && parallel_for_function<Function, Index>)
+void parallel_for(Index first, Index last, Index step, const Function& f, tuning_partitioner& partitioner, task_group_context &context) {
+    parallel_for_impl(first, last, step, f, partitioner, context);
+}
+#endif
+
+#if __TBB_PREVIEW_BANDWIDTH_PARTITIONER
+//! Parallel iteration over a range of integers with explicit step, task group context, and bandwidth_partitioner
+template <typename Index, typename Function>
+    __TBB_requires(parallel_for_index<Index> && parallel_for_function<Function, Index>)
+void parallel_for(Index first, Index last, Index step, const Function& f, bandwidth_partitioner& partitioner, task_group_context &context) {
+    parallel_for_impl(first, last, step, f, partitioner, context);
+}
+#endif
+
 //! Parallel iteration over a range of integers with a default step value, explicit task group context, and default partitioner
 template <typename Index, typename Function>
     __TBB_requires(parallel_for_index<Index> && parallel_for_function<Function, Index>)
@@ -452,6 +590,24 @@ template <typename Index, typename Function>
 void parallel_for(Index first, Index last, const Function& f, affinity_partitioner& partitioner, task_group_context &context) {
     parallel_for_impl(first, last, static_cast<Index>(1), f, partitioner, context);
 }
+
+#if __TBB_PREVIEW_TUNING_PARTITIONER
+//! Parallel iteration over a range of integers with a default step value, explicit task group context, and tuning_partitioner
+template <typename Index, typename Function>
+    __TBB_requires(parallel_for_index<Index> && parallel_for_function<Function, Index>)
+void parallel_for(Index first, Index last, const Function& f, tuning_partitioner& partitioner, task_group_context &context) {
+    parallel_for_impl(first, last, static_cast<Index>(1), f, partitioner, context);
+}
+#endif
+
+#if __TBB_PREVIEW_BANDWIDTH_PARTITIONER
+//! Parallel iteration over a range of integers with a default step value, explicit task group context, and bandwidth_partitioner
+template <typename Index, typename Function>
+    __TBB_requires(parallel_for_index<Index> && parallel_for_function<Function, Index>)
+void parallel_for(Index first, Index last, const Function& f, bandwidth_partitioner& partitioner, task_group_context &context) {
+    parallel_for_impl(first, last, static_cast<Index>(1), f, partitioner, context);
+}
+#endif
 // @}
 
 } // namespace d1
@@ -30,6 +30,9 @@
 
 #include <iterator>
 #include <type_traits>
+#if __TBB_PREVIEW_PARALLEL_FOR_EACH_BATCHING
+#include <vector>
+#endif
 
 namespace tbb {
 namespace detail {
@@ -62,12 +65,37 @@ class feeder {
     virtual ~feeder () {}
     virtual void internal_add_copy(const Item& item) = 0;
     virtual void internal_add_move(Item&& item) = 0;
+#if __TBB_PREVIEW_PARALLEL_FOR_EACH_BATCHING
+    virtual void internal_add_batch(std::vector<Item>&& items) = 0;
+
+    static constexpr std::size_t max_batch_size = 256;
+#endif
 
     template<typename Body_, typename Item_> friend class d2::feeder_impl;
 public:
     //! Add a work item to a running parallel_for_each.
     void add(const Item& item) {internal_add_copy(item);}
     void add(Item&& item) {internal_add_move(std::move(item));}
+
+#if __TBB_PREVIEW_PARALLEL_FOR_EACH_BATCHING
+    //! Add the work items of [first, last) to a running parallel_for_each.
+    /** The items are spawned in batches of up to 256 items, and each batch is split between
+        the threads on demand. Move semantics are used when supported by the iterator. **/
+    template<typename InputIterator>
+    void add_range(InputIterator first, InputIterator last) {
+        std::vector<Item> items;
+        for (; !(first == last); ++first) {
+            items.emplace_back(*first);
+            if (items.size() == max_batch_size) {
+                internal_add_batch(std::move(items));
+                items.clear();
+            }
+        }
+        if (!items.empty()) {
+            internal_add_batch(std::move(items));
+        }
+    }
+#endif
 };
 
 } // namespace d1
@@ -194,7 +222,13 @@ class feeder_impl : public feeder<Item> {
 
         spawn(*task, my_execution_context);
     }
+
+#if __TBB_PREVIEW_PARALLEL_FOR_EACH_BATCHING
+    //! Spawns one task that processes all the items
+    void internal_add_batch(std::vector<Item>&& items) override;
+#endif
 public:
+
     feeder_impl(const Body& body, wait_context_vertex& w_context, task_group_context &context)
       : my_body(body),
         my_wait_context(w_context)
@@ -403,6 +437,86 @@ public:
     }
 }; // class parallel_for_body_wrapper
 
+#if __TBB_PREVIEW_PARALLEL_FOR_EACH_BATCHING
+// Like for feeder_item_task, the body may take the fed items by non-constant lvalue references
+template <typename Body, typename Item, typename = void>
+struct feeder_batch_iterator_helper {
+    using type = Item*;
+};
+
+template <typename Body, typename Item>
+struct feeder_batch_iterator_helper<Body, Item,
+    tbb::detail::void_t<decltype(parallel_for_each_operator_selector<Body>::call(std::declval<const Body&>(),
+                                                                                 std::declval<Item&&>(),
+                                                                                 std::declval<feeder_impl<Body, Item>*>()))>>
+{
+    using type = std::move_iterator<Item*>;
+};
+
+/** Processes a batch of items taken from an input sequence or added with the feeder.
+  * The batch is executed with parallel_for, which splits it further when it is stolen.
+    @ingroup algorithms **/
+template <typename Body, typename Item, typename Iterator>
+struct for_each_batch_task : public task {
+    using iterator_type = Iterator;
+
+    for_each_batch_task(std::vector<Item>&& items, const Body& body, feeder_impl<Body, Item>* feeder_ptr,
+                        task_group_context& e_context, small_object_allocator& alloc,
+                        wait_tree_vertex_interface& wait_vertex)
+        : my_items(std::move(items)), my_body(body), my_feeder_ptr(feeder_ptr), my_execution_context(e_context),
+          my_allocator(alloc), m_wait_tree_vertex(r1::get_thread_reference_vertex(&wait_vertex))
+    {
+        m_wait_tree_vertex->reserve();
+    }
+
+    void finalize(const execution_data& ed) {
+        wait_tree_vertex_interface* wait_vertex = m_wait_tree_vertex;
+        my_allocator.delete_object(this, ed);
+        wait_vertex->release();
+    }
+
+    task* execute(execution_data& ed) override {
+        __TBB_ASSERT(!my_items.empty(), "Empty batch was passed to task");
+        iterator_type first(my_items.data());
+        if (my_items.size() == 1) {
+            parallel_for_each_operator_selector<Body>::call(my_body, *first, my_feeder_ptr);
+        } else {
+            tbb::parallel_for(tbb::blocked_range<std::size_t>(0, my_items.size()),
+                              parallel_for_body_wrapper<iterator_type, Body, Item>(first, my_body, my_feeder_ptr),
+                              auto_partitioner(), my_execution_context);
+        }
+        finalize(ed);
+        return nullptr;
+    }
+
+    task* cancel(execution_data& ed) override {
+        finalize(ed);
+        return nullptr;
+    }
+
+    std::vector<Item> my_items;
+    const Body& my_body;
+    feeder_impl<Body, Item>* my_feeder_ptr;
+    task_group_context& my_execution_context;
+    small_object_allocator my_allocator;
+    wait_tree_vertex_interface* m_wait_tree_vertex;
+}; // class for_each_batch_task
+
+template <typename Body, typename Item>
+void feeder_impl<Body, Item>::internal_add_batch(std::vector<Item>&& items) {
+    if (items.size() == 1) {
+        internal_add_move(std::move(items.front()));
+        return;
+    }
+    using batch_task = for_each_batch_task<Body, Item, typename feeder_batch_iterator_helper<Body, Item>::type>;
+    small_object_allocator alloc{};
+    auto task = alloc.new_object<batch_task>(std::move(items), my_body, this, my_execution_context, alloc,
+                                             my_wait_context);
+    spawn(*task, my_execution_context);
+}
+
+#endif // __TBB_PREVIEW_PARALLEL_FOR_EACH_BATCHING
+
 
 /** Helper for getting iterators tag including inherited custom tags
     @ingroup algorithms */
@@ -507,6 +621,44 @@ class for_each_root_task : public for_each_root_task_base<Iterator, Body, Item>
 public:
     using base_type::base_type;
 private:
+#if __TBB_PREVIEW_PARALLEL_FOR_EACH_BATCHING
+    static constexpr std::size_t max_block_size = 256;
+
+    task* execute(execution_data& ed) override {
+        using batch_task = for_each_batch_task<Body, Item, typename input_iteration_task_iterator_helper<Body, Item>::type>;
+
+        if (this->my_first == this->my_last) {
+            this->my_wait_context.release();
+            return nullptr;
+        }
+
+        // The blocks grow while the fetching thread comes back for the next one
+        // and shrink when other threads take the root task, so that they do not wait for the input
+        if (is_stolen_task(ed)) {
+            my_block_size = my_block_size > 1 ? my_block_size / 2 : 1;
+        } else if (my_block_size < max_block_size) {
+            my_block_size *= 2;
+        }
+
+        std::vector<Item> items;
+        items.reserve(my_block_size);
+        for (; !(this->my_first == this->my_last) && items.size() < my_block_size; ++this->my_first) {
+            // Move semantics are automatically used when supported by the iterator
+            items.emplace_back(*this->my_first);
+        }
+
+        small_object_allocator alloc{};
+        auto block_task = alloc.new_object<batch_task>(ed, std::move(items), this->my_body,
+                                                       this->my_feeder_holder.feeder_ptr(),
+                                                       this->my_execution_context, alloc, this->my_wait_context);
+
+        // Do not access this after spawn to avoid races
+        spawn(*this, this->my_execution_context);
+        return block_task;
+    }
+
+    std::size_t my_block_size{2};
+#else
     task* execute(execution_data& ed) override {
         using block_handling_type = input_block_handling_task<Body, Item>;
 
@@ -532,6 +684,7 @@ private:
         spawn(*this, this->my_execution_context);
         return block_handling_task;
     }
+#endif
 }; // class for_each_root_task - most generic implementation
 
 /** parallel_for_each algorithm root task - forward iterator based specialization
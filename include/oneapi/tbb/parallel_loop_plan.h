@@ -0,0 +1,267 @@
+/*
+    Copyright (c) 2025 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef __TBB_parallel_loop_plan_H
+#define __TBB_parallel_loop_plan_H
+
+#if ! TBB_PREVIEW_PARALLEL_LOOP_PLAN
+    #error Set TBB_PREVIEW_PARALLEL_LOOP_PLAN to include parallel_loop_plan.h
+#endif
+
+#include "detail/_config.h"
+#include "detail/_namespace_injection.h"
+#include "detail/_exception.h"
+#include "detail/_task.h"
+#include "detail/_template_helpers.h"
+#include "detail/_utils.h"
+
+#include "profiling.h"
+#include "task_group.h"
+#include "task_arena.h"
+#include "cache_aligned_allocator.h"
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace tbb {
+namespace detail {
+namespace d1 {
+
+//! Executes the same loop many times with the chunks and their owners computed once
+/** The range is split into chunks when the plan is constructed, and every participant of the loop
+    owns a contiguous block of the chunks. run() starts the participants once for all the iterations.
+    In each iteration a participant executes its own chunks and then takes the chunks not yet started
+    by the others. The participant that completes the last chunk of an iteration starts the next one
+    by advancing the epoch; the others spin until that happens. A participant that starts late or
+    does not start at all is replaced by the others taking its chunks.
+    @ingroup algorithms **/
+template <typename Range>
+class parallel_loop_plan : no_copy {
+    struct participant_state {
+        //! The number of chunks of the participant claimed since the start of run()
+        std::atomic<std::size_t> claimed{0};
+        std::size_t begin{0};
+        std::size_t end{0};
+    };
+    using participant_type = padded<participant_state>;
+
+    //! Limits the number of chunks for ranges with a tiny grain size
+    static constexpr int max_split_depth = 16;
+
+    std::vector<Range> my_chunks;
+    std::vector<participant_type, cache_aligned_allocator<participant_type>> my_participants;
+    //! The number of chunks completed since the start of run()
+    padded<std::atomic<std::size_t>> my_completed;
+    //! The iteration that may be executed
+    padded<std::atomic<std::size_t>> my_epoch;
+
+    template <typename Body, typename EpochEnd>
+    struct run_state {
+        parallel_loop_plan& plan;
+        const Body& body;
+        const EpochEnd& epoch_end;
+        std::size_t num_iterations;
+    };
+
+    template <typename State>
+    struct participant_task : public task {
+        State& my_state;
+        std::size_t my_index;
+        wait_context& my_wait_context;
+        small_object_allocator my_allocator;
+
+        participant_task( State& state, std::size_t index, wait_context& w_o, small_object_allocator& alloc )
+            : my_state(state), my_index(index), my_wait_context(w_o), my_allocator(alloc) {}
+
+        void finalize( const execution_data& ed ) {
+            wait_context& w_o = my_wait_context;
+            my_allocator.delete_object<participant_task>(this, ed);
+            w_o.release();
+        }
+        task* execute( execution_data& ed ) override {
+            my_state.plan.participate(my_state, my_index, *ed.context);
+            finalize(ed);
+            return nullptr;
+        }
+        task* cancel( execution_data& ed ) override {
+            finalize(ed);
+            return nullptr;
+        }
+    };
+
+    static int split_depth( std::size_t num_chunks ) {
+        int depth = 0;
+        while (depth < max_split_depth && (std::size_t(1) << depth) < num_chunks) {
+            ++depth;
+        }
+        return depth;
+    }
+
+    void split_into_chunks( const Range& range, int depth ) {
+        if (depth == 0 || !range.is_divisible()) {
+            my_chunks.push_back(range);
+        } else {
+            Range left(range);
+            Range right(left, split());
+            split_into_chunks(left, depth - 1);
+            split_into_chunks(right, depth - 1);
+        }
+    }
+
+    //! Claims the next chunk of participant p in the iteration; returns false if there is none
+    bool claim( std::size_t p, std::size_t iteration, std::size_t& chunk ) {
+        participant_state& owner = my_participants[p];
+        std::size_t size = owner.end - owner.begin;
+        std::size_t claimed = owner.claimed.load(std::memory_order_relaxed);
+        do {
+            if (claimed >= (iteration + 1) * size) {
+                return false;
+            }
+        } while (!owner.claimed.compare_exchange_weak(claimed, claimed + 1, std::memory_order_relaxed));
+        chunk = owner.begin + (claimed - iteration * size);
+        return true;
+    }
+
+    template <typename State>
+    void execute_chunk( State& state, std::size_t chunk, std::size_t iteration ) {
+        // Nested parallelism in the body must not pick up a participant that would wait for the epoch
+        isolate([&] { state.body(my_chunks[chunk], iteration); });
+        if (my_completed.fetch_add(1, std::memory_order_acq_rel) + 1 == (iteration + 1) * my_chunks.size()) {
+            state.epoch_end(iteration);
+            my_epoch.store(iteration + 1, std::memory_order_release);
+        }
+    }
+
+    //! Returns false if the loop was cancelled while waiting
+    bool wait_for_epoch( std::size_t iteration, task_group_context& context ) {
+        for (atomic_backoff backoff; my_epoch.load(std::memory_order_acquire) < iteration; backoff.pause()) {
+            if (context.is_group_execution_cancelled()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename State>
+    void participate( State& state, std::size_t p, task_group_context& context ) {
+        std::size_t num_participants = my_participants.size();
+        for (std::size_t iteration = 0; iteration < state.num_iterations; ++iteration) {
+            if (!wait_for_epoch(iteration, context)) {
+                return;
+            }
+            std::size_t chunk = 0;
+            // Own chunks first, then the neighbours' ones that are not started yet
+            for (std::size_t k = 0; k < num_participants; ++k) {
+                std::size_t owner = (p + k) % num_participants;
+                while (claim(owner, iteration, chunk)) {
+                    execute_chunk(state, chunk, iteration);
+                }
+            }
+        }
+    }
+
+    template <typename Body, typename EpochEnd>
+    void run_impl( std::size_t num_iterations, const Body& body, const EpochEnd& epoch_end,
+                   task_group_context& context )
+    {
+        if (num_iterations == 0 || my_chunks.empty()) {
+            return;
+        }
+        for (participant_type& state : my_participants) {
+            state.claimed.store(0, std::memory_order_relaxed);
+        }
+        my_completed.store(0, std::memory_order_relaxed);
+        my_epoch.store(0, std::memory_order_relaxed);
+
+        using state_type = run_state<Body, EpochEnd>;
+        using task_type = participant_task<state_type>;
+        state_type state{*this, body, epoch_end, num_iterations};
+        std::size_t num_tasks = my_participants.size();
+        wait_context w_ctx{static_cast<std::uint32_t>(num_tasks)};
+        small_object_allocator alloc{};
+        for (std::size_t k = 1; k < num_tasks; ++k) {
+            spawn(*alloc.new_object<task_type>(state, k, w_ctx, alloc), context);
+        }
+        execute_and_wait(*alloc.new_object<task_type>(state, 0, w_ctx, alloc), context, w_ctx, context);
+    }
+
+    struct no_epoch_end {
+        void operator()( std::size_t ) const {}
+    };
+
+public:
+    using range_type = Range;
+
+    //! Splits the range into about four chunks per thread of the current arena
+    explicit parallel_loop_plan( const Range& range )
+        : parallel_loop_plan(range, 4 * static_cast<std::size_t>(max_concurrency())) {}
+
+    //! Splits the range into at most the next power of two of num_chunks chunks
+    parallel_loop_plan( const Range& range, std::size_t num_chunks ) {
+        if (range.empty()) {
+            return;
+        }
+        split_into_chunks(range, split_depth(num_chunks));
+        std::size_t num_participants = static_cast<std::size_t>(max_concurrency());
+        if (num_participants > my_chunks.size()) {
+            num_participants = my_chunks.size();
+        }
+        my_participants = decltype(my_participants)(num_participants);
+        for (std::size_t p = 0; p < num_participants; ++p) {
+            my_participants[p].begin = p * my_chunks.size() / num_participants;
+            my_participants[p].end = (p + 1) * my_chunks.size() / num_participants;
+        }
+    }
+
+    std::size_t num_chunks() const { return my_chunks.size(); }
+    std::size_t num_participants() const { return my_participants.size(); }
+
+    //! Executes body(chunk, iteration) for every chunk in each of num_iterations iterations
+    /** All the chunks of an iteration complete before any chunk of the next iteration starts. **/
+    template <typename Body>
+    void run( std::size_t num_iterations, const Body& body ) {
+        task_group_context context(PARALLEL_FOR);
+        run(num_iterations, body, context);
+    }
+    template <typename Body>
+    void run( std::size_t num_iterations, const Body& body, task_group_context& context ) {
+        run_impl(num_iterations, body, no_epoch_end(), context);
+    }
+
+    //! Like run(num_iterations, body), and calls epoch_end(iteration) once all the chunks of the iteration complete
+    /** epoch_end is called by one thread before the next iteration starts. **/
+    template <typename Body, typename EpochEnd>
+    void run( std::size_t num_iterations, const Body& body, const EpochEnd& epoch_end ) {
+        task_group_context context(PARALLEL_FOR);
+        run(num_iterations, body, epoch_end, context);
+    }
+    template <typename Body, typename EpochEnd>
+    void run( std::size_t num_iterations, const Body& body, const EpochEnd& epoch_end, task_group_context& context ) {
+        run_impl(num_iterations, body, epoch_end, context);
+    }
+};
+
+} // namespace d1
+} // namespace detail
+
+inline namespace v1 {
+using detail::d1::parallel_loop_plan;
+} // namespace v1
+
+} // namespace tbb
+
+#endif /* __TBB_parallel_loop_plan_H */
@@ -20,17 +20,38 @@
 #include "detail/_pipeline_filters.h"
 #include "detail/_config.h"
 #include "detail/_namespace_injection.h"
+#include "detail/_template_helpers.h"
+#include "cache_aligned_allocator.h"
 #include "task_group.h"
 
 #include <cstddef>
 #include <atomic>
 #include <type_traits>
+#if __TBB_PREVIEW_PIPELINE_BATCHING
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#endif
+#if __TBB_PREVIEW_PIPELINE_BRANCHES
+#include "parallel_invoke.h"
+#include <tuple>
+#endif
 
 namespace tbb {
 namespace detail {
 
+#if __TBB_PREVIEW_PIPELINE_LIMITS
+namespace d1 {
+class pipeline_limits;
+}
+#endif
+
 namespace r1 {
 TBB_EXPORT void __TBB_EXPORTED_FUNC parallel_pipeline(task_group_context&, std::size_t, const d1::filter_node&);
+#if __TBB_PREVIEW_PIPELINE_LIMITS
+TBB_EXPORT void __TBB_EXPORTED_FUNC parallel_pipeline(task_group_context&, const d1::pipeline_limits&, const d1::filter_node&);
+#endif
 }
 
 namespace d1 {
@@ -51,6 +72,9 @@ class filter {
     filter_node_ptr my_root;
     filter( filter_node_ptr root ) : my_root(root) {}
     friend void parallel_pipeline( size_t, const filter<void,void>&, task_group_context& );
+#if __TBB_PREVIEW_PIPELINE_LIMITS
+    friend void parallel_pipeline( const pipeline_limits&, const filter<void,void>&, task_group_context& );
+#endif
     template<typename T_, typename U_, typename Body>
     friend filter<T_,U_> make_filter( filter_mode, const Body& );
     template<typename T_, typename V_, typename U_>
@@ -114,6 +138,596 @@ filter(filter_mode, Body)
 ->filter<filter_input<Body>, filter_output<Body>>;
 #endif // __TBB_CPP17_DEDUCTION_GUIDES_PRESENT
 
+#if __TBB_PREVIEW_PIPELINE_BATCHING
+//! Chooses the number of items per token of batch filters from the measured cost of an item
+class pipeline_batch_controller : no_copy {
+public:
+    //! The work per token that makes the cost of passing the token between the filters negligible
+    static constexpr std::uint64_t target_token_time_ns = 20000;
+    static constexpr std::size_t initial_batch_size = 16;
+
+    explicit pipeline_batch_controller(std::size_t max_batch_size)
+        : my_max_batch_size(max_batch_size > 0 ? max_batch_size : 1),
+          my_batch_size(initial_batch_size < my_max_batch_size ? initial_batch_size : my_max_batch_size) {}
+
+    //! The number of items the input filter puts into the next batch
+    std::size_t batch_size() const { return my_batch_size.load(std::memory_order_relaxed); }
+    std::size_t max_batch_size() const { return my_max_batch_size; }
+
+    //! Accounts the time the items of a batch spent in the batch filters
+    void record(std::size_t num_items, std::uint64_t time_ns) {
+        if (num_items == 0) {
+            return;
+        }
+        double cost = double(time_ns) / double(num_items);
+        double average = my_item_cost.load(std::memory_order_relaxed);
+        // Concurrent updates may overwrite each other, which only slows down the adaptation
+        average = average == 0 ? cost : average + (cost - average) / 8;
+        my_item_cost.store(average, std::memory_order_relaxed);
+        double size = average > 0 ? double(target_token_time_ns) / average : double(my_max_batch_size);
+        my_batch_size.store(size < 1 ? 1 : size >= double(my_max_batch_size) ? my_max_batch_size : std::size_t(size),
+                            std::memory_order_relaxed);
+    }
+
+    static std::uint64_t now() {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+private:
+    template<typename OutputType, typename Body> friend struct batch_input_body;
+
+    const std::size_t my_max_batch_size;
+    std::atomic<std::size_t> my_batch_size;
+    //! Moving average of the time an item spends in the batch filters, in nanoseconds
+    std::atomic<double> my_item_cost{0};
+    //! The input ended in the middle of the last batch, which was passed down the pipeline
+    std::atomic<bool> my_input_stopped{false};
+};
+
+//! Token of batch filters that holds several items
+/** The items keep their order within the batch, so serial_in_order filters see all the items
+    in the order of the input. **/
+template<typename T>
+class pipeline_batch {
+    using container_type = std::vector<T>;
+public:
+    using value_type = T;
+    using iterator = typename container_type::iterator;
+    using const_iterator = typename container_type::const_iterator;
+    using size_type = typename container_type::size_type;
+
+    pipeline_batch() = default;
+    pipeline_batch(const pipeline_batch&) = delete;
+    pipeline_batch& operator=(const pipeline_batch&) = delete;
+
+    pipeline_batch(pipeline_batch&& other) noexcept
+        : my_items(std::move(other.my_items)), my_controller(other.my_controller), my_time(other.my_time)
+    {
+        other.my_controller = nullptr;
+    }
+
+    pipeline_batch& operator=(pipeline_batch&& other) noexcept {
+        if (this != &other) {
+            report();
+            my_items = std::move(other.my_items);
+            my_controller = other.my_controller;
+            my_time = other.my_time;
+            other.my_controller = nullptr;
+        }
+        return *this;
+    }
+
+    ~pipeline_batch() { report(); }
+
+    iterator begin() { return my_items.begin(); }
+    iterator end() { return my_items.end(); }
+    const_iterator begin() const { return my_items.begin(); }
+    const_iterator end() const { return my_items.end(); }
+    size_type size() const { return my_items.size(); }
+    bool empty() const { return my_items.empty(); }
+    T& operator[](size_type i) { return my_items[i]; }
+    const T& operator[](size_type i) const { return my_items[i]; }
+
+private:
+    template<typename U> friend class pipeline_batch;
+    template<typename OutputType, typename Body> friend struct batch_input_body;
+    template<typename InputType, typename OutputType, typename Body> friend struct batch_body;
+    template<typename InputType, typename Body> friend struct batch_output_body;
+
+    //! Passes the accumulated time to the batch that holds the results of this one
+    template<typename U>
+    void take_accounting(pipeline_batch<U>& source, std::uint64_t time) {
+        my_controller = source.my_controller;
+        my_time = source.my_time + time;
+        source.my_controller = nullptr;
+    }
+
+    void report() {
+        if (my_controller) {
+            my_controller->record(my_items.size(), my_time);
+            my_controller = nullptr;
+        }
+    }
+
+    container_type my_items;
+    //! The controller of the input filter, or nullptr if the accounting has moved to another batch
+    pipeline_batch_controller* my_controller{nullptr};
+    //! The time the items spent in the batch filters so far
+    std::uint64_t my_time{0};
+};
+
+//! Body of an input batch filter: calls the body for each item of the batch
+template<typename OutputType, typename Body>
+struct batch_input_body {
+    Body my_body;
+    std::shared_ptr<pipeline_batch_controller> my_controller;
+
+    pipeline_batch<OutputType> operator()(flow_control& control) const {
+        pipeline_batch<OutputType> batch;
+        if (my_controller->my_input_stopped.exchange(false, std::memory_order_relaxed)) {
+            control.stop();
+            return batch;
+        }
+        std::size_t size = my_controller->batch_size();
+        batch.my_items.reserve(size);
+        std::uint64_t start = pipeline_batch_controller::now();
+        flow_control item_control;
+        while (batch.my_items.size() < size) {
+            OutputType item = my_body(item_control);
+            if (item_control.is_pipeline_stopped) {
+                if (batch.my_items.empty()) {
+                    control.stop();
+                    return batch;
+                }
+                // The items read so far go down the pipeline, and the next call stops it
+                my_controller->my_input_stopped.store(true, std::memory_order_relaxed);
+                break;
+            }
+            batch.my_items.push_back(std::move(item));
+        }
+        batch.my_time = pipeline_batch_controller::now() - start;
+        batch.my_controller = my_controller.get();
+        return batch;
+    }
+};
+
+//! Body of an intermediate batch filter: transforms each item of the batch
+template<typename InputType, typename OutputType, typename Body>
+struct batch_body {
+    Body my_body;
+
+    pipeline_batch<OutputType> operator()(pipeline_batch<InputType> batch) const {
+        std::uint64_t start = pipeline_batch_controller::now();
+        pipeline_batch<OutputType> result;
+        result.my_items.reserve(batch.size());
+        for (InputType& item : batch.my_items) {
+            result.my_items.push_back(tbb::detail::invoke(my_body, std::move(item)));
+        }
+        result.take_accounting(batch, pipeline_batch_controller::now() - start);
+        return result;
+    }
+};
+
+//! Body of an output batch filter: consumes each item of the batch
+template<typename InputType, typename Body>
+struct batch_output_body {
+    Body my_body;
+
+    void operator()(pipeline_batch<InputType> batch) const {
+        std::uint64_t start = pipeline_batch_controller::now();
+        for (InputType& item : batch) {
+            tbb::detail::invoke(my_body, std::move(item));
+        }
+        // The destructor of the batch reports the time to the controller
+        batch.my_time += pipeline_batch_controller::now() - start;
+    }
+};
+
+template<typename T>
+struct batch_token { using type = pipeline_batch<T>; };
+template<>
+struct batch_token<void> { using type = void; };
+
+template<typename T>
+using batch_token_t = typename batch_token<T>::type;
+
+template<typename InputType, typename OutputType>
+struct batch_filter_factory {
+    template<typename Body>
+    static filter<pipeline_batch<InputType>, pipeline_batch<OutputType>> make( filter_mode mode, const Body& body, std::size_t ) {
+        return make_filter<pipeline_batch<InputType>, pipeline_batch<OutputType>>(
+            mode, batch_body<InputType, OutputType, Body>{body});
+    }
+};
+
+template<typename OutputType>
+struct batch_filter_factory<void, OutputType> {
+    template<typename Body>
+    static filter<void, pipeline_batch<OutputType>> make( filter_mode mode, const Body& body, std::size_t max_batch_size ) {
+        return make_filter<void, pipeline_batch<OutputType>>(
+            mode, batch_input_body<OutputType, Body>{body, std::make_shared<pipeline_batch_controller>(max_batch_size)});
+    }
+};
+
+template<typename InputType>
+struct batch_filter_factory<InputType, void> {
+    template<typename Body>
+    static filter<pipeline_batch<InputType>, void> make( filter_mode mode, const Body& body, std::size_t ) {
+        return make_filter<pipeline_batch<InputType>, void>(mode, batch_output_body<InputType, Body>{body});
+    }
+};
+
+//! Create a filter that passes up to max_batch_size items per token
+/** The body processes one item at a time, like the body of make_filter. The input batch filter
+    chooses the number of items of every batch, up to max_batch_size, from the measured time the
+    items spend in the batch filters; the argument is ignored by the other filters.
+    @ingroup algorithms */
+template<typename InputType, typename OutputType, typename Body>
+filter<batch_token_t<InputType>, batch_token_t<OutputType>>
+make_batch_filter( filter_mode mode, const Body& body, std::size_t max_batch_size = 1024 ) {
+    static_assert(!std::is_void<InputType>::value || !std::is_void<OutputType>::value,
+                  "A batch filter must have an input or an output");
+    return batch_filter_factory<InputType, OutputType>::make(mode, body, max_batch_size);
+}
+
+//! Create a filter that passes up to max_batch_size items per token
+/** @ingroup algorithms */
+template<typename Body>
+filter<batch_token_t<filter_input<Body>>, batch_token_t<filter_output<Body>>>
+make_batch_filter( filter_mode mode, const Body& body, std::size_t max_batch_size = 1024 ) {
+    return make_batch_filter<filter_input<Body>, filter_output<Body>>(mode, body, max_batch_size);
+}
+#endif // __TBB_PREVIEW_PIPELINE_BATCHING
+
+#if __TBB_PREVIEW_PIPELINE_LIMITS
+//! Limits of a pipeline that adapts the number of live tokens to the load
+/** The pipeline starts with the initial number of tokens and adds a token each time the input
+    filter would otherwise wait for one, up to the maximal number of tokens. If the byte limit is
+    set, the input filter also stops reading while the items it has read and that have not left
+    the pipeline yet take at least that many bytes.
+    @ingroup algorithms **/
+class pipeline_limits {
+    //! Returns the size of an item produced by the first filter
+    struct item_size_base {
+        virtual ~item_size_base() = default;
+        virtual std::size_t size(void* object) const = 0;
+    };
+
+    template<typename T, typename SizeOf>
+    struct item_size_function : item_size_base {
+        SizeOf my_size_of;
+        explicit item_size_function(const SizeOf& size_of) : my_size_of(size_of) {}
+        std::size_t size(void* object) const override {
+            using helper = token_helper<T, use_allocator<T>::value>;
+            typename helper::pointer token = helper::cast_from_void_ptr(object);
+            // The item stays in the pipeline, so a token that owns it gives the ownership back
+            auto token_guard = make_raii_guard([&] { helper::cast_to_void_ptr(token); });
+            return my_size_of(static_cast<const T&>(helper::token(token)));
+        }
+    };
+
+    template<typename T, typename SizeOf, typename = void>
+    struct is_item_size_function : std::false_type {};
+
+    template<typename T, typename SizeOf>
+    struct is_item_size_function<T, SizeOf, void_t<decltype(std::declval<const SizeOf&>()(std::declval<const T&>()))>>
+        : std::is_convertible<decltype(std::declval<const SizeOf&>()(std::declval<const T&>())), std::size_t> {};
+
+    std::size_t my_initial_tokens;
+    std::size_t my_max_tokens;
+    std::size_t my_max_bytes{0};
+    //! Shared by the copies of the limits
+    std::shared_ptr<const item_size_base> my_item_size;
+
+public:
+    //! Starts with as many tokens as there are threads in the current arena
+    explicit pipeline_limits(std::size_t max_number_of_live_tokens)
+        : pipeline_limits(0, max_number_of_live_tokens) {}
+
+    //! Starts with initial_number_of_live_tokens tokens; zero means the concurrency of the current arena
+    pipeline_limits(std::size_t initial_number_of_live_tokens, std::size_t max_number_of_live_tokens)
+        : my_initial_tokens(initial_number_of_live_tokens), my_max_tokens(max_number_of_live_tokens)
+    {
+        __TBB_ASSERT(my_max_tokens > 0, "pipeline must have at least one token");
+        __TBB_ASSERT(my_initial_tokens <= my_max_tokens, "initial number of tokens exceeds the maximum");
+    }
+
+    //! Stops the input while the items in flight take at least max_bytes
+    /** size_of is called with const T& for each item produced by the first filter, whose output
+        type must be T; it may be any function object, and its copy is shared by the copies of the
+        limits. An item is accounted until it leaves the last filter. **/
+    template<typename T, typename SizeOf>
+    pipeline_limits& limit_bytes(std::size_t max_bytes, const SizeOf& size_of) {
+        using size_of_type = typename std::decay<SizeOf>::type;
+        static_assert(is_item_size_function<T, size_of_type>::value,
+                      "size_of must be callable with const T& and return a value convertible to std::size_t");
+        __TBB_ASSERT(max_bytes > 0, "byte limit must be positive");
+        my_max_bytes = max_bytes;
+        my_item_size = std::make_shared<item_size_function<T, size_of_type>>(size_of);
+        return *this;
+    }
+
+    std::size_t initial_tokens() const { return my_initial_tokens; }
+    std::size_t max_tokens() const { return my_max_tokens; }
+    //! Zero if the bytes in flight are not limited
+    std::size_t max_bytes() const { return my_max_bytes; }
+
+    //! The size of an item produced by the first filter
+    std::size_t item_size(void* object) const {
+        return my_item_size ? my_item_size->size(object) : 0;
+    }
+};
+#endif // __TBB_PREVIEW_PIPELINE_LIMITS
+
+#if __TBB_PREVIEW_PIPELINE_OBJECT_POOL
+template<typename T> class pipeline_object_pool;
+
+template<typename T>
+struct pipeline_object_pool_node {
+    T my_object;
+    pipeline_object_pool<T>* my_pool;
+    pipeline_object_pool_node* my_next;
+};
+
+//! Owner of an object of a pipeline_object_pool
+template<typename T>
+class pipeline_object_pool_handle {
+    using node = pipeline_object_pool_node<T>;
+    node* my_node{nullptr};
+
+    friend class pipeline_object_pool<T>;
+    template<typename, bool> friend struct token_helper;
+    explicit pipeline_object_pool_handle(node* n) : my_node(n) {}
+
+    node* release() {
+        node* n = my_node;
+        my_node = nullptr;
+        return n;
+    }
+
+public:
+    pipeline_object_pool_handle() = default;
+    pipeline_object_pool_handle(pipeline_object_pool_handle&& other) noexcept : my_node(other.release()) {}
+    pipeline_object_pool_handle& operator=(pipeline_object_pool_handle&& other) noexcept {
+        if (this != &other) {
+            reset();
+            my_node = other.release();
+        }
+        return *this;
+    }
+    ~pipeline_object_pool_handle() { reset(); }
+
+    T& operator*() const { return my_node->my_object; }
+    T* operator->() const { return &my_node->my_object; }
+    T* get() const { return my_node ? &my_node->my_object : nullptr; }
+    explicit operator bool() const { return my_node != nullptr; }
+
+    //! Returns the object to the pool
+    void reset() {
+        if (my_node) {
+            my_node->my_pool->release(release());
+        }
+    }
+};
+
+// A handle is passed between the filters as the pointer to its node, without allocating a token
+template<typename T>
+struct use_allocator<pipeline_object_pool_handle<T>> {
+    static constexpr bool value = false;
+};
+
+template<typename T>
+struct token_helper<pipeline_object_pool_handle<T>, false> {
+    using pointer = pipeline_object_pool_handle<T>;
+    using value_type = pipeline_object_pool_handle<T>;
+    static pointer create_token(value_type&& source) { return std::move(source); }
+    static value_type& token(pointer& t) { return t; }
+    static void* cast_to_void_ptr(pointer& ref) { return ref.release(); }
+    static pointer cast_from_void_ptr(void* ref) {
+        return pointer(static_cast<pipeline_object_pool_node<T>*>(ref));
+    }
+    static void destroy_token(pointer& token) { token.reset(); }
+};
+
+//! Pool of objects, such as scratch buffers, that the tokens of a pipeline take and give back
+/** acquire() returns a handle that owns an object of the pool. When the handle is destroyed,
+    for example together with the token that carries it, the object goes back to the pool
+    without being destroyed, so the memory it holds is reused by the next token.
+    The pool must outlive the handles.
+    @ingroup algorithms **/
+template<typename T>
+class pipeline_object_pool : no_copy {
+    using node = pipeline_object_pool_node<T>;
+    static_assert(alignof(node) <= max_nfs_size, "the objects of the pool cannot be aligned stricter than a cache line");
+
+    friend class pipeline_object_pool_handle<T>;
+
+    std::atomic<node*> my_free_nodes{nullptr};
+    //! True while a thread takes a node from the free list
+    std::atomic<bool> my_pop_busy{false};
+    std::atomic<std::size_t> my_size{0};
+
+    void release(node* n) {
+        node* head = my_free_nodes.load(std::memory_order_relaxed);
+        do {
+            n->my_next = head;
+        } while (!my_free_nodes.compare_exchange_weak(head, n, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    //! Takes a node from the free list; returns nullptr if it is empty or another thread takes a node
+    /** Only one thread at a time takes nodes, so the head read by it cannot leave the list and
+        come back before the compare-and-swap, and the list has no ABA problem. **/
+    node* try_pop() {
+        if (!my_free_nodes.load(std::memory_order_relaxed) || my_pop_busy.exchange(true, std::memory_order_acquire)) {
+            return nullptr;
+        }
+        node* head = my_free_nodes.load(std::memory_order_acquire);
+        while (head && !my_free_nodes.compare_exchange_weak(head, head->my_next, std::memory_order_acquire)) {}
+        my_pop_busy.store(false, std::memory_order_release);
+        return head;
+    }
+
+public:
+    using value_type = T;
+    using handle = pipeline_object_pool_handle<T>;
+
+    pipeline_object_pool() = default;
+    ~pipeline_object_pool() {
+        node* n = my_free_nodes.load(std::memory_order_relaxed);
+        while (n) {
+            node* next = n->my_next;
+            n->~node();
+            r1::cache_aligned_deallocate(n);
+            n = next;
+        }
+    }
+
+    //! Returns an object given back earlier, or a new default-constructed object if there is none
+    /** The object keeps the state left by its previous owner. A thread that finds another one
+        taking an object from the pool creates a new object instead of waiting. **/
+    handle acquire() {
+        node* n = try_pop();
+        if (!n) {
+            void* storage = r1::cache_aligned_allocate(sizeof(node));
+            auto storage_guard = make_raii_guard([&] { r1::cache_aligned_deallocate(storage); });
+            n = new (storage) node{};
+            storage_guard.dismiss();
+            n->my_pool = this;
+            ++my_size;
+        }
+        return handle(n);
+    }
+
+    //! The number of objects created by the pool
+    std::size_t size() const { return my_size.load(std::memory_order_relaxed); }
+};
+#endif // __TBB_PREVIEW_PIPELINE_OBJECT_POOL
+
+#if __TBB_PREVIEW_PIPELINE_BRANCHES
+//! The type of the result of a branch; branches that return nothing give nullptr
+template<typename Body, typename InputType>
+using branch_result_t = typename std::conditional<
+    std::is_void<decltype(tbb::detail::invoke(std::declval<const Body&>(), std::declval<const InputType&>()))>::value,
+    std::nullptr_t,
+    typename std::decay<decltype(tbb::detail::invoke(std::declval<const Body&>(), std::declval<const InputType&>()))>::type
+>::type;
+
+//! Storage for the result of a branch, which need not be default-constructible
+template<typename T>
+class branch_result_slot : no_copy {
+    alignas(T) unsigned char my_storage[sizeof(T)];
+    bool my_constructed{false};
+
+public:
+    branch_result_slot() = default;
+    ~branch_result_slot() {
+        if (my_constructed) {
+            reinterpret_cast<T*>(my_storage)->~T();
+        }
+    }
+
+    template<typename Body, typename InputType>
+    void compute(const Body& body, const InputType& input, /*is_void = */ std::false_type) {
+        new (my_storage) T(tbb::detail::invoke(body, input));
+        my_constructed = true;
+    }
+    template<typename Body, typename InputType>
+    void compute(const Body& body, const InputType& input, /*is_void = */ std::true_type) {
+        tbb::detail::invoke(body, input);
+        new (my_storage) T(nullptr);
+        my_constructed = true;
+    }
+
+    T&& take() {
+        __TBB_ASSERT(my_constructed, "the branch has not completed");
+        return std::move(*reinterpret_cast<T*>(my_storage));
+    }
+};
+
+template<typename F>
+void invoke_branches(const F& f) {
+    f();
+}
+
+template<typename... Fs>
+void invoke_branches(const Fs&... fs) {
+    parallel_invoke(fs...);
+}
+
+//! Calls all the branches on the same item concurrently and collects their results into a tuple
+template<typename InputType, typename... Bodies>
+class split_body {
+    std::tuple<Bodies...> my_bodies;
+
+    template<std::size_t I>
+    using body_type = typename std::tuple_element<I, std::tuple<Bodies...>>::type;
+
+    template<std::size_t I>
+    using is_void_branch = std::is_void<decltype(tbb::detail::invoke(std::declval<const body_type<I>&>(), std::declval<const InputType&>()))>;
+
+    template<std::size_t... Is>
+    std::tuple<branch_result_t<Bodies, InputType>...> run(const InputType& input, index_sequence<Is...>) const {
+        std::tuple<branch_result_slot<branch_result_t<Bodies, InputType>>...> slots;
+        invoke_branches([&] {
+            std::get<Is>(slots).compute(std::get<Is>(my_bodies), input, is_void_branch<Is>());
+        }...);
+        return std::tuple<branch_result_t<Bodies, InputType>...>(std::get<Is>(slots).take()...);
+    }
+
+public:
+    split_body(const Bodies&... bodies) : my_bodies(bodies...) {}
+
+    std::tuple<branch_result_t<Bodies, InputType>...> operator()(const InputType& input) const {
+        return run(input, make_index_sequence<sizeof...(Bodies)>());
+    }
+};
+
+//! Passes the elements of the tuple produced by a split filter to the body as separate arguments
+template<typename Body>
+class merge_body {
+    Body my_body;
+
+    template<typename Tuple, std::size_t... Is>
+    auto run(Tuple&& results, index_sequence<Is...>) const
+        -> decltype(tbb::detail::invoke(std::declval<const Body&>(), std::get<Is>(std::move(results))...))
+    {
+        return tbb::detail::invoke(my_body, std::get<Is>(std::move(results))...);
+    }
+
+public:
+    merge_body(const Body& body) : my_body(body) {}
+
+    template<typename Tuple>
+    auto operator()(Tuple results) const
+        -> decltype(this->run(std::move(results), make_index_sequence<std::tuple_size<Tuple>::value>()))
+    {
+        return run(std::move(results), make_index_sequence<std::tuple_size<Tuple>::value>());
+    }
+};
+
+//! Create a filter that passes each item to all the branches and outputs the tuple of their results
+/** The branches are called concurrently on the same item. The item takes one token for all
+    the branches, and the next filter receives the results of all the branches at once.
+    @ingroup algorithms */
+template<typename InputType, typename... Bodies>
+filter<InputType, std::tuple<branch_result_t<typename std::decay<Bodies>::type, InputType>...>>
+make_split_filter( filter_mode mode, const Bodies&... bodies ) {
+    static_assert(!std::is_void<InputType>::value, "the split filter cannot be the first filter");
+    static_assert(sizeof...(Bodies) > 0, "the split filter needs at least one branch");
+    return make_filter<InputType, std::tuple<branch_result_t<typename std::decay<Bodies>::type, InputType>...>>(mode,
+        split_body<InputType, typename std::decay<Bodies>::type...>(bodies...));
+}
+
+//! Create a filter that calls body with the results of the branches of a split filter
+/** A serial_in_order merge filter receives the results in the order of the items.
+    @ingroup algorithms */
+template<typename InputTuple, typename OutputType, typename Body>
+filter<InputTuple, OutputType> make_merge_filter( filter_mode mode, const Body& body ) {
+    return make_filter<InputTuple, OutputType>(mode, merge_body<typename std::decay<Body>::type>(body));
+}
+#endif // __TBB_PREVIEW_PIPELINE_BRANCHES
+
 //! Parallel pipeline over chain of filters with user-supplied context.
 /** @ingroup algorithms **/
 inline void parallel_pipeline(size_t max_number_of_live_tokens, const filter<void,void>& filter_chain, task_group_context& context) {
@@ -137,6 +751,31 @@ void parallel_pipeline(size_t max_number_of_live_tokens,
     parallel_pipeline(max_number_of_live_tokens, filter1 & filter2, std::forward<FiltersContext>(filters)...);
 }
 
+#if __TBB_PREVIEW_PIPELINE_LIMITS
+//! Parallel pipeline with adaptive number of tokens over chain of filters with user-supplied context.
+/** @ingroup algorithms **/
+inline void parallel_pipeline(const pipeline_limits& limits, const filter<void,void>& filter_chain, task_group_context& context) {
+    r1::parallel_pipeline(context, limits, *filter_chain.my_root);
+}
+
+//! Parallel pipeline with adaptive number of tokens over chain of filters.
+/** @ingroup algorithms **/
+inline void parallel_pipeline(const pipeline_limits& limits, const filter<void,void>& filter_chain) {
+    task_group_context context;
+    parallel_pipeline(limits, filter_chain, context);
+}
+
+//! Parallel pipeline with adaptive number of tokens over sequence of filters.
+/** @ingroup algorithms **/
+template<typename F1, typename F2, typename... FiltersContext>
+void parallel_pipeline(const pipeline_limits& limits,
+                              const F1& filter1,
+                              const F2& filter2,
+                              FiltersContext&&... filters) {
+    parallel_pipeline(limits, filter1 & filter2, std::forward<FiltersContext>(filters)...);
+}
+#endif // __TBB_PREVIEW_PIPELINE_LIMITS
+
 } // namespace d1
 } // namespace detail
 
@@ -147,6 +786,20 @@ using detail::d1::filter;
 using detail::d1::make_filter;
 using detail::d1::filter_mode;
 using detail::d1::flow_control;
+#if __TBB_PREVIEW_PIPELINE_BATCHING
+using detail::d1::pipeline_batch;
+using detail::d1::make_batch_filter;
+#endif
+#if __TBB_PREVIEW_PIPELINE_LIMITS
+using detail::d1::pipeline_limits;
+#endif
+#if __TBB_PREVIEW_PIPELINE_OBJECT_POOL
+using detail::d1::pipeline_object_pool;
+#endif
+#if __TBB_PREVIEW_PIPELINE_BRANCHES
+using detail::d1::make_split_filter;
+using detail::d1::make_merge_filter;
+#endif
 }
 } // tbb
 
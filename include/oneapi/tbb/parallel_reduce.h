@@ -83,6 +83,59 @@ struct reduction_tree_node : public tree_node {
     }
 };
 
+#if __TBB_PREVIEW_PREALLOCATED_TASK_TREE
+//! Leaf task of parallel_reduce with static_partitioner, placed in a static_task_tree
+/** Every leaf but the root splits its own body from the body of the root; the caller joins the
+    bodies in the order of their ranges after all the leaves complete.
+    @ingroup algorithms */
+template<typename Range, typename Body>
+struct static_tree_reduce : public task {
+    using tree_type = static_task_tree<static_tree_reduce>;
+
+    Range my_range;
+    Body* my_body;
+    tree_type& my_tree;
+    tbb::detail::aligned_space<Body> my_body_space;
+    bool my_has_body{false};
+
+    static_tree_reduce( const Range& range, Body& body, tree_type& tree ) :
+        my_range(range), my_body(&body), my_tree(tree) {}
+
+    ~static_tree_reduce() {
+        if( my_has_body ) my_body_space.begin()->~Body();
+    }
+
+    task* execute(execution_data& ed) override {
+        if( this == &my_tree[0] ) {
+            my_tree.spawn_leaves(my_range, [this]( const Range& r ) -> static_tree_reduce& {
+                return my_tree.emplace(r, *my_body, my_tree);
+            }, *context(ed));
+        } else {
+            my_body = new( my_body_space.begin() ) Body(*my_body, split());
+            my_has_body = true;
+        }
+        tbb::detail::invoke(*my_body, my_range);
+        my_tree.release();
+        return nullptr;
+    }
+    task* cancel(execution_data&) override {
+        my_tree.release();
+        return nullptr;
+    }
+
+    static void run(const Range& range, Body& body, task_group_context& context) {
+        tree_type tree(static_task_tree_capacity());
+        static_tree_reduce& root = tree.emplace(range, body, tree);
+        execute_and_wait(root, context, tree.wait(), context);
+        // The leaves after the root follow in reverse order of their ranges
+        for( std::size_t i = tree.size(); i > 1 && !context.is_group_execution_cancelled(); --i ) {
+            if( tree[i - 1].my_has_body )
+                body.join(*tree[i - 1].my_body);
+        }
+    }
+};
+#endif // __TBB_PREVIEW_PREALLOCATED_TASK_TREE
+
 //! Task type used to split the work of parallel_reduce.
 /** @ingroup algorithms */
 template<typename Range, typename Body, typename Partitioner>
@@ -136,6 +189,12 @@ struct start_reduce : public task {
     }
     static void run(const Range& range, Body& body, Partitioner& partitioner, task_group_context& context) {
         if ( !range.empty() ) {
+#if __TBB_PREVIEW_PREALLOCATED_TASK_TREE
+            if ( std::is_same<typename std::remove_const<Partitioner>::type, static_partitioner>::value ) {
+                static_tree_reduce<Range, Body>::run(range, body, context);
+                return;
+            }
+#endif
             wait_node wn;
             small_object_allocator alloc{};
             auto reduce_task = alloc.new_object<start_reduce>(range, body, partitioner, alloc);
@@ -280,6 +339,12 @@ struct start_deterministic_reduce : public task {
         my_allocator(alloc) {}
     static void run(const Range& range, Body& body, Partitioner& partitioner, task_group_context& context) {
         if ( !range.empty() ) {
+#if __TBB_PREVIEW_PREALLOCATED_TASK_TREE
+            if ( std::is_same<typename std::remove_const<Partitioner>::type, static_partitioner>::value ) {
+                static_tree_reduce<Range, Body>::run(range, body, context);
+                return;
+            }
+#endif
             wait_node wn;
             small_object_allocator alloc{};
             auto deterministic_reduce_task =
@@ -464,6 +529,26 @@ void parallel_reduce( const Range& range, Body& body, affinity_partitioner& part
     start_reduce<Range,Body,affinity_partitioner>::run( range, body, partitioner );
 }
 
+#if __TBB_PREVIEW_TUNING_PARTITIONER
+//! Parallel iteration with reduction and tuning_partitioner
+/** @ingroup algorithms **/
+template<typename Range, typename Body>
+    __TBB_requires(tbb_range<Range> && parallel_reduce_body<Body, Range>)
+void parallel_reduce( const Range& range, Body& body, tuning_partitioner& partitioner ) {
+    start_reduce<Range,Body,tuning_partitioner>::run( range, body, partitioner );
+}
+#endif
+
+#if __TBB_PREVIEW_BANDWIDTH_PARTITIONER
+//! Parallel iteration with reduction and bandwidth_partitioner
+/** @ingroup algorithms **/
+template<typename Range, typename Body>
+    __TBB_requires(tbb_range<Range> && parallel_reduce_body<Body, Range>)
+void parallel_reduce( const Range& range, Body& body, bandwidth_partitioner& partitioner ) {
+    start_reduce<Range,Body,bandwidth_partitioner>::run( range, body, partitioner );
+}
+#endif
+
 //! Parallel iteration with reduction, default partitioner and user-supplied context.
 /** @ingroup algorithms **/
 template<typename Range, typename Body>
@@ -503,6 +588,26 @@ template<typename Range, typename Body>
 void parallel_reduce( const Range& range, Body& body, affinity_partitioner& partitioner, task_group_context& context ) {
     start_reduce<Range,Body,affinity_partitioner>::run( range, body, partitioner, context );
 }
+
+#if __TBB_PREVIEW_TUNING_PARTITIONER
+//! Parallel iteration with reduction, tuning_partitioner and user-supplied context
+/** @ingroup algorithms **/
+template<typename Range, typename Body>
+    __TBB_requires(tbb_range<Range> && parallel_reduce_body<Body, Range>)
+void parallel_reduce( const Range& range, Body& body, tuning_partitioner& partitioner, task_group_context& context ) {
+    start_reduce<Range,Body,tuning_partitioner>::run( range, body, partitioner, context );
+}
+#endif
+
+#if __TBB_PREVIEW_BANDWIDTH_PARTITIONER
+//! Parallel iteration with reduction, bandwidth_partitioner and user-supplied context
+/** @ingroup algorithms **/
+template<typename Range, typename Body>
+    __TBB_requires(tbb_range<Range> && parallel_reduce_body<Body, Range>)
+void parallel_reduce( const Range& range, Body& body, bandwidth_partitioner& partitioner, task_group_context& context ) {
+    start_reduce<Range,Body,bandwidth_partitioner>::run( range, body, partitioner, context );
+}
+#endif
 /** parallel_reduce overloads that work with anonymous function objects
     (see also \ref parallel_reduce_lambda_req "requirements on parallel_reduce anonymous function objects"). **/
 
@@ -570,6 +675,36 @@ Value parallel_reduce( const Range& range, const Value& identity, const RealBody
     return std::move(body).result();
 }
 
+#if __TBB_PREVIEW_TUNING_PARTITIONER
+//! Parallel iteration with reduction and tuning_partitioner
+/** @ingroup algorithms **/
+template<typename Range, typename Value, typename RealBody, typename Reduction>
+    __TBB_requires(tbb_range<Range> && parallel_reduce_function<RealBody, Range, Value> &&
+                   parallel_reduce_combine<Reduction, Value>)
+Value parallel_reduce( const Range& range, const Value& identity, const RealBody& real_body, const Reduction& reduction,
+                       tuning_partitioner& partitioner ) {
+    lambda_reduce_body<Range,Value,RealBody,Reduction> body(identity, real_body, reduction);
+    start_reduce<Range,lambda_reduce_body<Range,Value,RealBody,Reduction>,tuning_partitioner>
+                                        ::run( range, body, partitioner );
+    return std::move(body).result();
+}
+#endif
+
+#if __TBB_PREVIEW_BANDWIDTH_PARTITIONER
+//! Parallel iteration with reduction and bandwidth_partitioner
+/** @ingroup algorithms **/
+template<typename Range, typename Value, typename RealBody, typename Reduction>
+    __TBB_requires(tbb_range<Range> && parallel_reduce_function<RealBody, Range, Value> &&
+                   parallel_reduce_combine<Reduction, Value>)
+Value parallel_reduce( const Range& range, const Value& identity, const RealBody& real_body, const Reduction& reduction,
+                       bandwidth_partitioner& partitioner ) {
+    lambda_reduce_body<Range,Value,RealBody,Reduction> body(identity, real_body, reduction);
+    start_reduce<Range,lambda_reduce_body<Range,Value,RealBody,Reduction>,bandwidth_partitioner>
+                                        ::run( range, body, partitioner );
+    return std::move(body).result();
+}
+#endif
+
 //! Parallel iteration with reduction, default partitioner and user-supplied context.
 /** @ingroup algorithms **/
 template<typename Range, typename Value, typename RealBody, typename Reduction>
@@ -635,6 +770,36 @@ Value parallel_reduce( const Range& range, const Value& identity, const RealBody
     return std::move(body).result();
 }
 
+#if __TBB_PREVIEW_TUNING_PARTITIONER
+//! Parallel iteration with reduction, tuning_partitioner and user-supplied context
+/** @ingroup algorithms **/
+template<typename Range, typename Value, typename RealBody, typename Reduction>
+    __TBB_requires(tbb_range<Range> && parallel_reduce_function<RealBody, Range, Value> &&
+                   parallel_reduce_combine<Reduction, Value>)
+Value parallel_reduce( const Range& range, const Value& identity, const RealBody& real_body, const Reduction& reduction,
+                       tuning_partitioner& partitioner, task_group_context& context ) {
+    lambda_reduce_body<Range,Value,RealBody,Reduction> body(identity, real_body, reduction);
+    start_reduce<Range,lambda_reduce_body<Range,Value,RealBody,Reduction>,tuning_partitioner>
+                                        ::run( range, body, partitioner, context );
+    return std::move(body).result();
+}
+#endif
+
+#if __TBB_PREVIEW_BANDWIDTH_PARTITIONER
+//! Parallel iteration with reduction, bandwidth_partitioner and user-supplied context
+/** @ingroup algorithms **/
+template<typename Range, typename Value, typename RealBody, typename Reduction>
+    __TBB_requires(tbb_range<Range> && parallel_reduce_function<RealBody, Range, Value> &&
+                   parallel_reduce_combine<Reduction, Value>)
+Value parallel_reduce( const Range& range, const Value& identity, const RealBody& real_body, const Reduction& reduction,
+                       bandwidth_partitioner& partitioner, task_group_context& context ) {
+    lambda_reduce_body<Range,Value,RealBody,Reduction> body(identity, real_body, reduction);
+    start_reduce<Range,lambda_reduce_body<Range,Value,RealBody,Reduction>,bandwidth_partitioner>
+                                        ::run( range, body, partitioner, context );
+    return std::move(body).result();
+}
+#endif
+
 //! Parallel iteration with deterministic reduction and default simple partitioner.
 /** @ingroup algorithms **/
 template<typename Range, typename Body>
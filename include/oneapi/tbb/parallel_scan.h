@@ -29,6 +29,15 @@
 #include "blocked_range.h"
 #include "task_group.h"
 
+#if __TBB_PREVIEW_PARALLEL_SCAN_SINGLE_PASS
+#include "cache_aligned_allocator.h"
+#include "task_arena.h"
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#endif
+
 namespace tbb {
 namespace detail {
 namespace d1 {
@@ -537,6 +546,200 @@ public:
     }
 };
 
+#if __TBB_PREVIEW_PARALLEL_SCAN_SINGLE_PASS
+//! Selects the single-pass parallel_scan with decoupled look-back.
+/** The range is split into ordered chunks down to its grain size. Each chunk publishes its
+    partial aggregate and then looks back at the aggregates of its predecessors, so the data
+    is scanned in a single pass over memory. The chunk should fit into a per-core cache.
+    @ingroup algorithms */
+class single_pass_partitioner {};
+
+//! State shared by the tasks of the single-pass scan
+/** @ingroup algorithms */
+template<typename Range, typename Body>
+class single_pass_scan : no_copy {
+    enum class chunk_state : int {
+        empty,      // Nothing is published yet
+        aggregate,  // Summary of the chunk alone is published
+        inclusive   // Summary of all the iterations up to and including the chunk is published
+    };
+
+    struct chunk_descriptor {
+        std::atomic<chunk_state> state{chunk_state::empty};
+        //! Accessed only by the owning thread and after all the tasks complete
+        bool has_aggregate{false};
+        bool has_inclusive{false};
+        aligned_space<Body> aggregate;
+        aligned_space<Body> inclusive;
+    };
+    using descriptor_type = padded<chunk_descriptor>;
+
+    //! Limits the number of chunks for ranges with a tiny grain size
+    static constexpr int max_split_depth = 16;
+
+    Body& m_body;
+    std::vector<Range> m_chunks;
+    cache_aligned_allocator<descriptor_type> m_allocator;
+    descriptor_type* m_descriptors{nullptr};
+    std::atomic<std::size_t> m_next_chunk{0};
+
+    void split_into_chunks( const Range& range, int depth ) {
+        if( depth == 0 || !range.is_divisible() ) {
+            m_chunks.push_back(range);
+        } else {
+            Range left(range);
+            Range right(left, split());
+            split_into_chunks(left, depth - 1);
+            split_into_chunks(right, depth - 1);
+        }
+    }
+
+    void publish( chunk_descriptor& d, chunk_state state ) {
+        d.state.store(state, std::memory_order_release);
+    }
+
+    //! Returns false if the scan was cancelled while waiting for predecessors.
+    bool process_chunk( std::size_t i, task_group_context& context ) {
+        chunk_descriptor& d = m_descriptors[i];
+        const Range& range = m_chunks[i];
+        // The body that performs the final scan starts as the exclusive prefix of the chunk
+        Body* prefix = nullptr;
+        if( i == 0 ) {
+            prefix = new( d.inclusive.begin() ) Body(m_body, split());
+            d.has_inclusive = true;
+            prefix->reverse_join(m_body);
+        } else if( m_descriptors[i - 1].state.load(std::memory_order_acquire) == chunk_state::inclusive ) {
+            // The predecessor is complete: scan the chunk once, without the look-back
+            Body& predecessor = *m_descriptors[i - 1].inclusive.begin();
+            prefix = new( d.inclusive.begin() ) Body(predecessor, split());
+            d.has_inclusive = true;
+            prefix->reverse_join(predecessor);
+        } else {
+            Body* aggregate = new( d.aggregate.begin() ) Body(m_body, split());
+            d.has_aggregate = true;
+            (*aggregate)(range, pre_scan_tag());
+            publish(d, chunk_state::aggregate);
+
+            prefix = new( d.inclusive.begin() ) Body(m_body, split());
+            d.has_inclusive = true;
+            for( std::size_t j = i; j-- > 0; ) {
+                chunk_descriptor& predecessor = m_descriptors[j];
+                chunk_state state = predecessor.state.load(std::memory_order_acquire);
+                for( atomic_backoff backoff; state == chunk_state::empty;
+                     state = predecessor.state.load(std::memory_order_acquire) )
+                {
+                    if( context.is_group_execution_cancelled() ) {
+                        return false;
+                    }
+                    backoff.pause();
+                }
+                if( state == chunk_state::inclusive ) {
+                    prefix->reverse_join(*predecessor.inclusive.begin());
+                    break;
+                }
+                prefix->reverse_join(*predecessor.aggregate.begin());
+            }
+        }
+        (*prefix)(range, final_scan_tag());
+        publish(d, chunk_state::inclusive);
+        return true;
+    }
+
+public:
+    single_pass_scan( const Range& range, Body& body ) : m_body(body) {
+        split_into_chunks(range, max_split_depth);
+    }
+
+    ~single_pass_scan() {
+        if( m_descriptors ) {
+            for( std::size_t i = 0; i < m_chunks.size(); ++i ) {
+                descriptor_type& d = m_descriptors[i];
+                if( d.has_aggregate )
+                    d.aggregate.begin()->~Body();
+                if( d.has_inclusive )
+                    d.inclusive.begin()->~Body();
+                d.~descriptor_type();
+            }
+            m_allocator.deallocate(m_descriptors, m_chunks.size());
+        }
+    }
+
+    //! Claims chunks in order until all of them are processed.
+    void process( task_group_context& context ) {
+        // A nested wait inside the body must not pick up another scan task that would
+        // wait for a chunk processed lower on the same stack.
+        auto process_chunks = [&] {
+            for( std::size_t i = m_next_chunk++; i < m_chunks.size(); i = m_next_chunk++ ) {
+                if( context.is_group_execution_cancelled() || !process_chunk(i, context) ) {
+                    break;
+                }
+            }
+        };
+        isolate_impl<void>(process_chunks);
+    }
+
+    static void run( const Range& range, Body& body );
+};
+
+//! Claims and processes chunks of the single-pass scan
+/** @ingroup algorithms */
+template<typename Range, typename Body>
+struct single_pass_scan_task : public task {
+    using scan_type = single_pass_scan<Range, Body>;
+    scan_type& m_scan;
+    wait_context& m_wait_context;
+    small_object_allocator m_allocator;
+
+    single_pass_scan_task( scan_type& scan, wait_context& w_o, small_object_allocator& alloc ) :
+        m_scan(scan), m_wait_context(w_o), m_allocator(alloc) {}
+
+    void finalize( const execution_data& ed ) {
+        wait_context& w_o = m_wait_context;
+        m_allocator.delete_object<single_pass_scan_task>(this, ed);
+        w_o.release();
+    }
+    task* execute( execution_data& ed ) override {
+        m_scan.process(*ed.context);
+        finalize(ed);
+        return nullptr;
+    }
+    task* cancel( execution_data& ed ) override {
+        finalize(ed);
+        return nullptr;
+    }
+};
+
+template<typename Range, typename Body>
+void single_pass_scan<Range, Body>::run( const Range& range, Body& body ) {
+    if( range.empty() )
+        return;
+    single_pass_scan scan(range, body);
+    std::size_t num_chunks = scan.m_chunks.size();
+    std::size_t num_tasks = std::min(num_chunks, static_cast<std::size_t>(max_concurrency()));
+    if( num_tasks <= 1 ) {
+        body(range, final_scan_tag());
+        return;
+    }
+
+    scan.m_descriptors = scan.m_allocator.allocate(num_chunks);
+    for( std::size_t i = 0; i < num_chunks; ++i )
+        new( &scan.m_descriptors[i] ) descriptor_type();
+
+    using task_type = single_pass_scan_task<Range, Body>;
+    task_group_context context(PARALLEL_SCAN);
+    wait_context w_ctx{static_cast<std::uint32_t>(num_tasks)};
+    small_object_allocator alloc{};
+    for( std::size_t k = 1; k < num_tasks; ++k )
+        spawn(*alloc.new_object<task_type>(scan, w_ctx, alloc), context);
+    execute_and_wait(*alloc.new_object<task_type>(scan, w_ctx, alloc), context, w_ctx, context);
+
+    // A cancelled scan may stop before the last chunk is scanned; the body is left as is then
+    chunk_descriptor& last = scan.m_descriptors[num_chunks - 1];
+    if( last.state.load(std::memory_order_acquire) == chunk_state::inclusive )
+        body.assign(*last.inclusive.begin());
+}
+#endif /* __TBB_PREVIEW_PARALLEL_SCAN_SINGLE_PASS */
+
 // Requirements on Range concept are documented in blocked_range.h
 
 /** \page parallel_scan_body_req Requirements on parallel_scan body
@@ -581,6 +784,16 @@ void parallel_scan( const Range& range, Body& body, const auto_partitioner& part
     start_scan<Range,Body,auto_partitioner>::run(range, body, partitioner);
 }
 
+#if __TBB_PREVIEW_PARALLEL_SCAN_SINGLE_PASS
+//! Parallel prefix with single_pass_partitioner
+/** @ingroup algorithms **/
+template<typename Range, typename Body>
+    __TBB_requires(tbb_range<Range> && parallel_scan_body<Body, Range>)
+void parallel_scan( const Range& range, Body& body, const single_pass_partitioner& ) {
+    single_pass_scan<Range, Body>::run(range, body);
+}
+#endif
+
 //! Parallel prefix with default partitioner
 /** @ingroup algorithms **/
 template<typename Range, typename Value, typename Scan, typename ReverseJoin>
@@ -616,6 +829,20 @@ Value parallel_scan( const Range& range, const Value& identity, const Scan& scan
     return body.result();
 }
 
+#if __TBB_PREVIEW_PARALLEL_SCAN_SINGLE_PASS
+//! Parallel prefix with single_pass_partitioner
+/** @ingroup algorithms **/
+template<typename Range, typename Value, typename Scan, typename ReverseJoin>
+    __TBB_requires(tbb_range<Range> && parallel_scan_function<Scan, Range, Value> &&
+                   parallel_scan_combine<ReverseJoin, Value>)
+Value parallel_scan( const Range& range, const Value& identity, const Scan& scan, const ReverseJoin& reverse_join,
+                     const single_pass_partitioner& partitioner ) {
+    lambda_scan_body<Range, Value, Scan, ReverseJoin> body(identity, scan, reverse_join);
+    parallel_scan(range, body, partitioner);
+    return body.result();
+}
+#endif
+
 } // namespace d1
 } // namespace detail
 
@@ -623,6 +850,9 @@ inline namespace v1 {
     using detail::d1::parallel_scan;
     using detail::d1::pre_scan_tag;
     using detail::d1::final_scan_tag;
+#if __TBB_PREVIEW_PARALLEL_SCAN_SINGLE_PASS
+    using detail::d1::single_pass_partitioner;
+#endif
 } // namespace v1
 
 } // namespace tbb
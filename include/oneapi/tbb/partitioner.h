@@ -50,6 +50,10 @@
 #include <algorithm>
 #include <atomic>
 #include <type_traits>
+#if __TBB_PREVIEW_TUNING_PARTITIONER || __TBB_PREVIEW_BANDWIDTH_PARTITIONER
+#include <chrono>
+#include <cstdint>
+#endif
 
 #if defined(_MSC_VER) && !defined(__INTEL_COMPILER)
     // Workaround for overzealous compiler warnings
@@ -67,6 +71,14 @@ class static_partitioner;
 class affinity_partitioner;
 class affinity_partition_type;
 class affinity_partitioner_base;
+#if __TBB_PREVIEW_TUNING_PARTITIONER
+class tuning_partitioner;
+class tuning_partition_type;
+#endif
+#if __TBB_PREVIEW_BANDWIDTH_PARTITIONER
+class bandwidth_partitioner;
+class bandwidth_partition_type;
+#endif
 
 inline std::size_t get_initial_auto_partitioner_divisor() {
     const std::size_t factor = 4;
@@ -253,6 +265,284 @@ public:
     }
 };
 
+#if __TBB_PREVIEW_TUNING_PARTITIONER
+//! Keeps the measurements of tuning_partitioner across invocations of algorithms.
+/** Every invocation is timed from its start to the completion of the last task. The moving average
+    of that time is kept for each tried splitting depth, and the next invocation uses the best depth,
+    its untried neighbours, or periodically a neighbour chosen by the observed stealing. */
+class tuning_partitioner_base: no_copy {
+    friend class tuning_partitioner;
+    friend class tuning_partition_type;
+    using clock_type = std::chrono::steady_clock;
+
+    //! The largest tried depth
+    static constexpr depth_t max_tuned_depth = 2 * __TBB_INIT_DEPTH;
+    //! A neighbour of the best depth is measured again once per probe_period invocations
+    static constexpr std::size_t probe_period = 16;
+
+public:
+    //! Measurements of a completed invocation
+    struct statistics {
+        //! Splitting depth used by the invocation
+        std::size_t depth{0};
+        //! Number of chunks the body was invoked for
+        std::size_t chunks{0};
+        //! Number of tasks executed by a thread other than the one they were spawned by
+        std::size_t steals{0};
+        //! Mean execution time of the body for a chunk, in seconds
+        double mean_chunk_time{0};
+        //! Time from the start of the invocation to the completion of its last task, in seconds
+        double elapsed_time{0};
+    };
+
+    //! The depth with the least average time
+    std::size_t depth() const { return my_best_depth; }
+    //! Number of completed invocations
+    std::size_t invocations() const { return my_invocations; }
+    //! Measurements of the last completed invocation
+    statistics last_invocation() const { return my_last; }
+    //! Forgets all measurements
+    void reset() {
+        std::fill_n(my_time, max_tuned_depth + 1, 0.);
+        std::fill_n(my_samples, max_tuned_depth + 1, std::size_t(0));
+        my_depth = my_best_depth = __TBB_INIT_DEPTH;
+        my_invocations = my_since_probe = 0;
+        my_last = statistics{};
+    }
+
+private:
+    tuning_partitioner_base() { reset(); }
+
+    //! Starts the measurement of an invocation and returns its depth
+    depth_t begin_invocation() {
+        // Tasks of a cancelled invocation did not report, so its measurement is dropped here
+        my_pending_tasks.store(1, std::memory_order_relaxed);
+        my_chunks.store(0, std::memory_order_relaxed);
+        my_steals.store(0, std::memory_order_relaxed);
+        my_chunk_time.store(0, std::memory_order_relaxed);
+        my_start = clock_type::now();
+        return my_depth;
+    }
+
+    void add_task() {
+        my_pending_tasks.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    //! Adds the measurements of a task; the last task completes the invocation
+    void end_task(std::size_t chunks, std::size_t steals, std::int64_t chunk_time) {
+        my_chunks.fetch_add(chunks, std::memory_order_relaxed);
+        my_steals.fetch_add(steals, std::memory_order_relaxed);
+        my_chunk_time.fetch_add(chunk_time, std::memory_order_relaxed);
+        if (my_pending_tasks.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            end_invocation();
+        }
+    }
+
+    void end_invocation() {
+        double elapsed = std::chrono::duration<double>(clock_type::now() - my_start).count();
+        std::size_t chunks = my_chunks.load(std::memory_order_relaxed);
+        my_last.depth = my_depth;
+        my_last.chunks = chunks;
+        my_last.steals = my_steals.load(std::memory_order_relaxed);
+        my_last.mean_chunk_time = chunks ? double(my_chunk_time.load(std::memory_order_relaxed)) * 1e-9 / chunks : 0.;
+        my_last.elapsed_time = elapsed;
+
+        double& time = my_time[my_depth];
+        time = my_samples[my_depth]++ ? time + (elapsed - time) / 4 : elapsed;
+        ++my_invocations;
+
+        for (depth_t d = 0; d <= max_tuned_depth; ++d) {
+            if (my_samples[d] && my_time[d] < my_time[my_best_depth]) {
+                my_best_depth = d;
+            }
+        }
+        my_depth = next_depth();
+    }
+
+    depth_t next_depth() {
+        depth_t best = my_best_depth;
+        if (best > 0 && !my_samples[best - 1]) {
+            return depth_t(best - 1);
+        }
+        if (best < max_tuned_depth && !my_samples[best + 1]) {
+            return depth_t(best + 1);
+        }
+        if (++my_since_probe < probe_period) {
+            return best;
+        }
+        my_since_probe = 0;
+        // Stealing indicates imbalance that finer chunks can reduce; otherwise try coarser chunks
+        bool deeper = my_last.steals ? best < max_tuned_depth : best == 0;
+        return depth_t(deeper ? best + 1 : best - 1);
+    }
+
+    //! Moving average of the invocation time for each depth, in seconds
+    double my_time[max_tuned_depth + 1];
+    std::size_t my_samples[max_tuned_depth + 1];
+    depth_t my_depth;
+    depth_t my_best_depth;
+    std::size_t my_invocations;
+    std::size_t my_since_probe;
+    statistics my_last;
+
+    // State of the running invocation
+    clock_type::time_point my_start{};
+    std::atomic<std::size_t> my_pending_tasks{0};
+    std::atomic<std::size_t> my_chunks{0};
+    std::atomic<std::size_t> my_steals{0};
+    //! Sum of the chunk execution times, in nanoseconds
+    std::atomic<std::int64_t> my_chunk_time{0};
+};
+#endif // __TBB_PREVIEW_TUNING_PARTITIONER
+
+#if __TBB_PREVIEW_BANDWIDTH_PARTITIONER
+//! Keeps the measurements of bandwidth_partitioner across invocations of algorithms.
+/** The number of threads tried for an invocation is a power of two or the concurrency of the arena.
+    Starting from one thread, the number is doubled while it shortens the invocation; the limit is the
+    least number of threads whose average time is within the tolerance of the best one. A neighbour of
+    the limit is measured again periodically, so the limit follows changes of the load. */
+class bandwidth_partitioner_base: no_copy {
+    friend class bandwidth_partitioner;
+    friend class bandwidth_partition_type;
+    using clock_type = std::chrono::steady_clock;
+
+    //! The number of tried thread counts: 1, 2, 4, ... up to the concurrency of the arena
+    static constexpr std::size_t max_levels = 8 * sizeof(std::size_t);
+    //! A neighbour of the limit is measured again once per probe_period invocations
+    static constexpr std::size_t probe_period = 16;
+
+public:
+    //! Measurements of a completed invocation
+    struct statistics {
+        //! Number of threads the invocation was limited to
+        std::size_t concurrency{0};
+        //! Time from the start of the invocation to the completion of its last task, in seconds
+        double elapsed_time{0};
+    };
+
+    //! Invocations that take up to this share of time more than the fastest ones are not slower
+    static constexpr double tolerance = 0.1;
+
+    //! The least number of threads that is as fast as any number of threads tried
+    std::size_t concurrency() const { return level_concurrency(my_limit); }
+    //! Number of completed invocations
+    std::size_t invocations() const { return my_invocations; }
+    //! Measurements of the last completed invocation
+    statistics last_invocation() const { return my_last; }
+    //! Forgets all measurements
+    void reset() {
+        std::fill_n(my_time, max_levels, 0.);
+        std::fill_n(my_samples, max_levels, std::size_t(0));
+        my_level = my_limit = 0;
+        my_invocations = my_since_probe = 0;
+        my_probe_up = true;
+        my_last = statistics{};
+    }
+
+private:
+    bandwidth_partitioner_base() : my_arena_concurrency(0) { reset(); }
+
+    std::size_t level_concurrency( std::size_t level ) const {
+        std::size_t n = std::size_t(1) << level;
+        return my_arena_concurrency && n > my_arena_concurrency ? my_arena_concurrency : n;
+    }
+    std::size_t num_levels() const {
+        std::size_t levels = 1;
+        while (level_concurrency(levels - 1) < my_arena_concurrency) {
+            ++levels;
+        }
+        return levels;
+    }
+
+    //! Starts the measurement of an invocation and returns the number of threads it may use
+    std::size_t begin_invocation() {
+        std::size_t arena_concurrency = static_cast<std::size_t>(max_concurrency());
+        if (arena_concurrency != my_arena_concurrency) {
+            // The measurements do not apply to another arena
+            reset();
+            my_arena_concurrency = arena_concurrency;
+        }
+        // Tasks of a cancelled invocation did not report, so its measurement is dropped here
+        my_pending_tasks.store(1, std::memory_order_relaxed);
+        my_start = clock_type::now();
+        return level_concurrency(my_level);
+    }
+
+    void add_task() {
+        my_pending_tasks.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    //! The last task completes the invocation
+    void end_task() {
+        if (my_pending_tasks.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            end_invocation();
+        }
+    }
+
+    void end_invocation() {
+        double elapsed = std::chrono::duration<double>(clock_type::now() - my_start).count();
+        my_last.concurrency = level_concurrency(my_level);
+        my_last.elapsed_time = elapsed;
+
+        double& time = my_time[my_level];
+        time = my_samples[my_level]++ ? time + (elapsed - time) / 4 : elapsed;
+        ++my_invocations;
+
+        double best_time = my_time[my_level];
+        for (std::size_t l = 0; l < max_levels; ++l) {
+            if (my_samples[l] && my_time[l] < best_time) {
+                best_time = my_time[l];
+            }
+        }
+        for (std::size_t l = 0; l < max_levels; ++l) {
+            if (my_samples[l] && my_time[l] <= best_time * (1 + tolerance)) {
+                my_limit = l;
+                break;
+            }
+        }
+        my_level = next_level();
+    }
+
+    std::size_t next_level() {
+        if (num_levels() == 1) {
+            return 0;
+        }
+        std::size_t highest = 0;
+        for (std::size_t l = 0; l < max_levels; ++l) {
+            if (my_samples[l]) {
+                highest = l;
+            }
+        }
+        // More threads helped so far: keep ramping up
+        if (my_limit == highest && highest + 1 < num_levels()) {
+            return highest + 1;
+        }
+        if (++my_since_probe < probe_period) {
+            return my_limit;
+        }
+        my_since_probe = 0;
+        my_probe_up = !my_probe_up;
+        bool up = my_probe_up ? my_limit + 1 < num_levels() : my_limit == 0;
+        return up ? my_limit + 1 : my_limit - 1;
+    }
+
+    //! Moving average of the invocation time for each number of threads, in seconds
+    double my_time[max_levels];
+    std::size_t my_samples[max_levels];
+    std::size_t my_arena_concurrency;
+    std::size_t my_level;
+    std::size_t my_limit;
+    std::size_t my_invocations;
+    std::size_t my_since_probe;
+    bool my_probe_up;
+    statistics my_last;
+
+    // State of the running invocation
+    clock_type::time_point my_start{};
+    std::atomic<std::size_t> my_pending_tasks{0};
+};
+#endif // __TBB_PREVIEW_BANDWIDTH_PARTITIONER
+
 //! Provides default methods for partition objects and common algorithm blocks.
 template <typename Partition>
 struct partition_type_base {
@@ -269,6 +559,12 @@ struct partition_type_base {
         start.run_body( range ); // static partitioner goes here
     }
 
+    //! Runs the body for a chunk produced by the range pool
+    template<typename StartType, typename Range>
+    void run_chunk(StartType &start, Range &range) {
+        start.run_body( range );
+    }
+
     template<typename StartType, typename Range>
     void execute(StartType &start, Range &range, execution_data& ed) {
         // The algorithm in a few words ([]-denotes calls to decision methods of partitioner):
@@ -432,7 +728,7 @@ struct dynamic_grainsize_mode : Mode {
     template<typename StartType, typename Range>
     void work_balance(StartType &start, Range &range, execution_data& ed) {
         if( !range.is_divisible() || !self().max_depth() ) {
-            start.run_body( range );
+            self().run_chunk( start, range );
         }
         else { // do range pool
             range_vector<Range, range_pool_size> range_pool(range);
@@ -447,7 +743,7 @@ struct dynamic_grainsize_mode : Mode {
                     if( range_pool.is_divisible(self().max_depth()) ) // was not enough depth to fork a task
                         continue; // note: next split_to_fill() should split range at least once
                 }
-                start.run_body( range_pool.back() );
+                self().run_chunk( start, range_pool.back() );
                 range_pool.pop_back();
             } while( !range_pool.empty() && !ed.context->is_group_execution_cancelled() );
         }
@@ -562,6 +858,89 @@ public:
     }
 };
 
+#if __TBB_PREVIEW_TUNING_PARTITIONER
+class tuning_partition_type: public dynamic_grainsize_mode<adaptive_mode<tuning_partition_type> > {
+    using base_type = dynamic_grainsize_mode<adaptive_mode<tuning_partition_type> >;
+    tuning_partitioner_base* my_tuner;
+    std::size_t my_chunks{0};
+    std::size_t my_steals{0};
+    std::int64_t my_chunk_time{0};
+public:
+    tuning_partition_type( tuning_partitioner_base& tp ) : my_tuner(&tp) {
+        my_divisor *= __TBB_INITIAL_CHUNKS;
+        my_max_depth = tp.begin_invocation();
+    }
+    tuning_partition_type( tuning_partition_type& src, split )
+        : base_type(src, split())
+        , my_tuner(src.my_tuner)
+    {
+        my_tuner->add_task();
+    }
+    bool is_divisible() { // same as for auto_partition_type
+        if( my_divisor > 1 ) return true;
+        if( my_divisor && my_max_depth ) {
+            my_max_depth--;
+            my_divisor = 0;
+            return true;
+        } else return false;
+    }
+    template <typename Task>
+    bool check_for_demand(Task& t) {
+        if (tree_node::is_peer_stolen(t)) {
+            my_max_depth += __TBB_DEMAND_DEPTH_ADD;
+            return true;
+        } else return false;
+    }
+    template <typename Task>
+    bool check_being_stolen(Task& t, const execution_data& ed) {
+        if (is_stolen_task(ed)) {
+            ++my_steals;
+        }
+        return base_type::check_being_stolen(t, ed);
+    }
+    template<typename StartType, typename Range>
+    void run_chunk(StartType &start, Range &range) {
+        auto t0 = tuning_partitioner_base::clock_type::now();
+        start.run_body( range );
+        my_chunk_time += std::chrono::duration_cast<std::chrono::nanoseconds>(
+            tuning_partitioner_base::clock_type::now() - t0).count();
+        ++my_chunks;
+    }
+    template<typename StartType, typename Range>
+    void work_balance(StartType &start, Range &range, execution_data& ed) {
+        base_type::work_balance(start, range, ed);
+        my_tuner->end_task(my_chunks, my_steals, my_chunk_time);
+    }
+    void spawn_task(task& t, task_group_context& ctx) {
+        spawn(t, ctx);
+    }
+};
+#endif // __TBB_PREVIEW_TUNING_PARTITIONER
+
+#if __TBB_PREVIEW_BANDWIDTH_PARTITIONER
+//! Splits the range into one part per allowed thread, as static_partitioner does for all the threads
+class bandwidth_partition_type : public linear_affinity_mode<bandwidth_partition_type> {
+    bandwidth_partitioner_base* my_limiter;
+public:
+    typedef detail::proportional_split split_type;
+    bandwidth_partition_type( bandwidth_partitioner_base& bp ) : my_limiter(&bp) {
+        // The parts are spread over the slots of the whole arena
+        my_divisor = bp.begin_invocation() * factor;
+    }
+    bandwidth_partition_type( bandwidth_partition_type& p, const proportional_split& split_obj )
+        : linear_affinity_mode<bandwidth_partition_type>(p, split_obj)
+        , my_limiter(p.my_limiter)
+    {
+        my_limiter->add_task();
+    }
+    template<typename StartType, typename Range>
+    void work_balance(StartType &start, Range &range, execution_data&) {
+        start.run_body( range );
+        my_limiter->end_task();
+    }
+};
+#endif // __TBB_PREVIEW_BANDWIDTH_PARTITIONER
+
 //! A simple partitioner
 /** Divides the range until the range is not divisible.
     @ingroup algorithms */
@@ -638,6 +1017,80 @@ private:
     typedef static_partition_type::split_type split_type;
 };
 
+#if __TBB_PREVIEW_PREALLOCATED_TASK_TREE
+//! Block of the leaf tasks of a tree that static_partitioner builds
+/** static_partitioner creates at most one leaf per thread of the arena, so all the leaves fit into a
+    block allocated before the execution, on the stack of the caller if the block is small. The root
+    leaf splits the range and spawns the other leaves; the caller waits for all of them at once, so
+    no inner nodes and no reference counting are needed. The leaves are destroyed with the block. **/
+template <typename Leaf>
+class static_task_tree : no_copy {
+    static constexpr std::size_t stack_bytes = 4096;
+    static constexpr std::size_t stack_capacity = sizeof(Leaf) < stack_bytes ? stack_bytes / sizeof(Leaf) : 1;
+
+    aligned_space<Leaf, stack_capacity> my_stack_space;
+    Leaf* my_leaves;
+    std::size_t my_capacity;
+    std::size_t my_size{0};
+    wait_context my_wait{1};
+
+    //! Splits off the right parts of the range while the partition is divisible
+    template <typename Range, typename MakeLeaf>
+    void split_off( Range& range, static_partition_type& partition, MakeLeaf& make_leaf,
+                    task_group_context& context )
+    {
+        while (range.is_divisible() && partition.is_divisible()) {
+            typename static_partition_type::split_type split_obj = partition.template get_split<Range>();
+            Range right_range(range, get_range_split_object<Range>(split_obj));
+            static_partition_type right_partition(partition, split_obj);
+            split_off(right_range, right_partition, make_leaf, context);
+            my_wait.reserve();
+            right_partition.spawn_task(make_leaf(right_range), context);
+        }
+    }
+
+public:
+    explicit static_task_tree( std::size_t capacity )
+        : my_leaves(capacity <= stack_capacity ? my_stack_space.begin()
+                                               : static_cast<Leaf*>(r1::cache_aligned_allocate(capacity * sizeof(Leaf))))
+        , my_capacity(capacity) {}
+
+    ~static_task_tree() {
+        for (std::size_t i = 0; i < my_size; ++i) {
+            my_leaves[i].~Leaf();
+        }
+        if (my_leaves != my_stack_space.begin()) {
+            r1::cache_aligned_deallocate(my_leaves);
+        }
+    }
+
+    template <typename... Args>
+    Leaf& emplace( Args&&... args ) {
+        __TBB_ASSERT(my_size < my_capacity, "static_partitioner created more leaves than threads");
+        return *new (my_leaves + my_size++) Leaf(std::forward<Args>(args)...);
+    }
+
+    //! Splits the range of the root leaf as static_partitioner does and spawns a leaf for every other part
+    /** make_leaf(range) emplaces a leaf. The leaves follow in reverse order of their ranges, after the root. **/
+    template <typename Range, typename MakeLeaf>
+    void spawn_leaves( Range& root_range, MakeLeaf make_leaf, task_group_context& context ) {
+        __TBB_ASSERT(my_size == 1, "spawn_leaves must be called once by the root leaf");
+        static_partition_type partition{static_partitioner()};
+        split_off(root_range, partition, make_leaf, context);
+    }
+
+    void release() { my_wait.release(); }
+    wait_context& wait() { return my_wait; }
+    std::size_t size() const { return my_size; }
+    Leaf& operator[]( std::size_t i ) { return my_leaves[i]; }
+};
+
+//! Capacity of the block for the leaves of a static_partitioner tree
+inline std::size_t static_task_tree_capacity() {
+    return get_initial_auto_partitioner_divisor() / 4;
+}
+#endif // __TBB_PREVIEW_PREALLOCATED_TASK_TREE
+
 //! An affinity partitioner
 class affinity_partitioner : affinity_partitioner_base {
 public:
@@ -654,6 +1107,53 @@ private:
     typedef affinity_partition_type::split_type split_type;
 };
 
+#if __TBB_PREVIEW_TUNING_PARTITIONER
+//! A partitioner that learns the splitting depth for a loop that is run many times
+/** The object keeps its measurements across invocations, so it should be reused for the same loop.
+    It must not be used by several algorithms at the same time.
+    @ingroup algorithms */
+class tuning_partitioner : tuning_partitioner_base {
+public:
+    tuning_partitioner() {}
+
+    using tuning_partitioner_base::statistics;
+    using tuning_partitioner_base::depth;
+    using tuning_partitioner_base::invocations;
+    using tuning_partitioner_base::last_invocation;
+    using tuning_partitioner_base::reset;
+
+private:
+    template<typename Range, typename Body, typename Partitioner> friend struct start_for;
+    template<typename Range, typename Body, typename Partitioner> friend struct start_reduce;
+    typedef tuning_partition_type task_partition_type;
+    typedef tuning_partition_type::split_type split_type;
+};
+#endif // __TBB_PREVIEW_TUNING_PARTITIONER
+
+#if __TBB_PREVIEW_BANDWIDTH_PARTITIONER
+//! A partitioner that learns how many threads a memory-bound loop can use
+/** Each invocation is split into one part per allowed thread, so the other threads stay free for
+    other work. The object keeps its measurements across invocations, so it should be reused for the
+    same loop. It must not be used by several algorithms at the same time.
+    @ingroup algorithms */
+class bandwidth_partitioner : bandwidth_partitioner_base {
+public:
+    bandwidth_partitioner() {}
+
+    using bandwidth_partitioner_base::statistics;
+    using bandwidth_partitioner_base::concurrency;
+    using bandwidth_partitioner_base::invocations;
+    using bandwidth_partitioner_base::last_invocation;
+    using bandwidth_partitioner_base::reset;
+
+private:
+    template<typename Range, typename Body, typename Partitioner> friend struct start_for;
+    template<typename Range, typename Body, typename Partitioner> friend struct start_reduce;
+    typedef bandwidth_partition_type task_partition_type;
+    typedef bandwidth_partition_type::split_type split_type;
+};
+#endif // __TBB_PREVIEW_BANDWIDTH_PARTITIONER
+
 } // namespace d1
 } // namespace detail
 
@@ -663,6 +1163,12 @@ using detail::d1::auto_partitioner;
 using detail::d1::simple_partitioner;
 using detail::d1::static_partitioner;
 using detail::d1::affinity_partitioner;
+#if __TBB_PREVIEW_TUNING_PARTITIONER
+using detail::d1::tuning_partitioner;
+#endif
+#if __TBB_PREVIEW_BANDWIDTH_PARTITIONER
+using detail::d1::bandwidth_partitioner;
+#endif
 // Split types
 using detail::split;
 using detail::proportional_split;
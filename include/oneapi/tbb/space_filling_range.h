@@ -0,0 +1,322 @@
+/*
+    Copyright (c) 2025 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef __TBB_space_filling_range_H
+#define __TBB_space_filling_range_H
+
+#if ! TBB_PREVIEW_SPACE_FILLING_RANGE
+    #error Set TBB_PREVIEW_SPACE_FILLING_RANGE to include space_filling_range.h
+#endif
+
+#include "detail/_config.h"
+#include "detail/_namespace_injection.h"
+#include "detail/_range_common.h"
+#include "detail/_template_helpers.h"
+
+#include "blocked_range.h"
+#include "blocked_range2d.h"
+#include "blocked_range3d.h"
+#include "blocked_nd_range.h"
+
+#include <array>
+#include <cstddef>
+
+namespace tbb {
+namespace detail {
+namespace d1 {
+
+//! Order in which space_filling_range visits its subranges
+enum class space_filling_curve {
+    //! Z-order: the dimensions are split in turn, and the lower half goes first
+    morton,
+    //! Consecutive subranges share a face
+    hilbert
+};
+
+//! Uniform access to the dimensions of multidimensional ranges
+template <typename Range>
+struct range_dimensions;
+
+template <typename RowValue, typename ColValue>
+struct range_dimensions<blocked_range2d<RowValue, ColValue>> {
+    using range_type = blocked_range2d<RowValue, ColValue>;
+    static constexpr unsigned count = 2;
+
+    static double extent( const range_type& r, unsigned d ) {
+        return d == 0 ? double(r.rows().size()) / r.rows().grainsize()
+                      : double(r.cols().size()) / r.cols().grainsize();
+    }
+    static bool is_divisible( const range_type& r, unsigned d ) {
+        return d == 0 ? r.rows().is_divisible() : r.cols().is_divisible();
+    }
+    //! Leaves the lower half of dimension d in r and returns the upper half
+    template <typename Split>
+    static range_type split( range_type& r, unsigned d, Split& split_obj ) {
+        auto rows = r.rows();
+        auto cols = r.cols();
+        if (d == 0) {
+            typename range_type::row_range_type upper(rows, split_obj);
+            r = make(rows, cols);
+            return make(upper, cols);
+        }
+        typename range_type::col_range_type upper(cols, split_obj);
+        r = make(rows, cols);
+        return make(rows, upper);
+    }
+    static range_type make( const typename range_type::row_range_type& rows,
+                            const typename range_type::col_range_type& cols ) {
+        return range_type(rows.begin(), rows.end(), rows.grainsize(), cols.begin(), cols.end(), cols.grainsize());
+    }
+};
+
+template <typename PageValue, typename RowValue, typename ColValue>
+struct range_dimensions<blocked_range3d<PageValue, RowValue, ColValue>> {
+    using range_type = blocked_range3d<PageValue, RowValue, ColValue>;
+    static constexpr unsigned count = 3;
+
+    static double extent( const range_type& r, unsigned d ) {
+        return d == 0 ? double(r.pages().size()) / r.pages().grainsize()
+             : d == 1 ? double(r.rows().size()) / r.rows().grainsize()
+                      : double(r.cols().size()) / r.cols().grainsize();
+    }
+    static bool is_divisible( const range_type& r, unsigned d ) {
+        return d == 0 ? r.pages().is_divisible() : d == 1 ? r.rows().is_divisible() : r.cols().is_divisible();
+    }
+    template <typename Split>
+    static range_type split( range_type& r, unsigned d, Split& split_obj ) {
+        auto pages = r.pages();
+        auto rows = r.rows();
+        auto cols = r.cols();
+        if (d == 0) {
+            typename range_type::page_range_type upper(pages, split_obj);
+            r = make(pages, rows, cols);
+            return make(upper, rows, cols);
+        }
+        if (d == 1) {
+            typename range_type::row_range_type upper(rows, split_obj);
+            r = make(pages, rows, cols);
+            return make(pages, upper, cols);
+        }
+        typename range_type::col_range_type upper(cols, split_obj);
+        r = make(pages, rows, cols);
+        return make(pages, rows, upper);
+    }
+    static range_type make( const typename range_type::page_range_type& pages,
+                            const typename range_type::row_range_type& rows,
+                            const typename range_type::col_range_type& cols ) {
+        return range_type(pages.begin(), pages.end(), pages.grainsize(),
+                          rows.begin(), rows.end(), rows.grainsize(),
+                          cols.begin(), cols.end(), cols.grainsize());
+    }
+};
+
+template <typename Value, unsigned int N>
+struct range_dimensions<blocked_nd_range<Value, N>> {
+    using range_type = blocked_nd_range<Value, N>;
+    using dims_type = std::array<typename range_type::dim_range_type, N>;
+    static constexpr unsigned count = N;
+
+    static double extent( const range_type& r, unsigned d ) {
+        return double(r.dim(d).size()) / r.dim(d).grainsize();
+    }
+    static bool is_divisible( const range_type& r, unsigned d ) {
+        return r.dim(d).is_divisible();
+    }
+    template <typename Split>
+    static range_type split( range_type& r, unsigned d, Split& split_obj ) {
+        dims_type dims = get_dims(r, make_index_sequence<N>());
+        typename range_type::dim_range_type upper(dims[d], split_obj);
+        r = make(dims, make_index_sequence<N>());
+        dims_type upper_dims = dims;
+        upper_dims[d] = upper;
+        return make(upper_dims, make_index_sequence<N>());
+    }
+    template <std::size_t... Is>
+    static dims_type get_dims( const range_type& r, index_sequence<Is...> ) {
+        return dims_type{ {r.dim(Is)...} };
+    }
+    template <std::size_t... Is>
+    static range_type make( const dims_type& dims, index_sequence<Is...> ) {
+        return range_type(dims[Is]...);
+    }
+};
+
+//! Range adaptor that splits a multidimensional range so that its subranges follow a space-filling curve
+/** The left subrange of every split, which is executed first by the splitting thread, precedes the
+    right one on the curve. For the Hilbert curve every subrange knows the corner where the curve
+    enters it and the axis along which it leaves through the opposite face. A subrange that is long
+    along its axis is cut across the axis; otherwise it is cut into Hilbert quadrants in the plane of
+    the axis and its longest other dimension, which takes two consecutive splits. Consecutive
+    subranges share a face unless the curve has to turn in a subrange that is too thin to be split
+    along its axis. **/
+template <typename Range, space_filling_curve Curve = space_filling_curve::hilbert>
+class space_filling_range {
+    using dimensions = range_dimensions<Range>;
+    static constexpr unsigned num_dims = dimensions::count;
+    static_assert(num_dims <= 32, "space_filling_range supports up to 32 dimensions");
+
+    Range my_range;
+    //! Bit d tells whether the curve enters at the upper end of dimension d
+    unsigned my_entry;
+    //! The curve leaves at the corner that differs from the entry in this dimension only;
+    //! for the Z-order, the dimension of the next split
+    unsigned my_axis;
+    //! The dimension of the second split of a quadrant step, or num_dims if there is none in progress
+    unsigned my_pending;
+    //! Whether the subrange holds the last two quadrants of the quadrant step
+    bool my_last_quadrants;
+
+public:
+    using range_type = Range;
+
+    explicit space_filling_range( const Range& range )
+        : my_range(range), my_entry(0),
+          my_axis(Curve == space_filling_curve::morton ? 0 : longest_dimension(range, num_dims)), my_pending(num_dims),
+          my_last_quadrants(false) {}
+
+    space_filling_range( space_filling_range& r, split split_obj ) : my_range(r.my_range) {
+        do_split(r, split_obj);
+    }
+    space_filling_range( space_filling_range& r, proportional_split& proportion ) : my_range(r.my_range) {
+        do_split(r, proportion);
+    }
+
+    bool empty() const { return my_range.empty(); }
+    bool is_divisible() const { return my_range.is_divisible(); }
+
+    //! The subrange of the underlying range
+    const Range& base() const { return my_range; }
+    //! Allows bodies written for the underlying range to be used without changes
+    operator const Range&() const { return my_range; }
+
+private:
+    static bool bit( unsigned mask, unsigned d ) { return (mask >> d) & 1u; }
+
+    //! Returns the longest divisible dimension other than excluded, or num_dims if there is none
+    static unsigned longest_dimension( const Range& r, unsigned excluded ) {
+        unsigned best = num_dims;
+        for (unsigned d = 0; d < num_dims; ++d) {
+            if (d != excluded && dimensions::is_divisible(r, d) &&
+                (best == num_dims || dimensions::extent(r, best) < dimensions::extent(r, d))) {
+                best = d;
+            }
+        }
+        return best;
+    }
+
+    void orient( unsigned entry, unsigned axis, unsigned pending, bool last_quadrants ) {
+        my_entry = entry;
+        my_axis = axis;
+        my_pending = pending;
+        my_last_quadrants = last_quadrants;
+    }
+
+    template <typename Split>
+    void do_split( space_filling_range& r, Split& split_obj ) {
+        __TBB_ASSERT(r.is_divisible(), "can't split not divisible range");
+        unsigned entry = r.my_entry;
+        unsigned axis = r.my_axis;
+        if (Curve == space_filling_curve::morton) {
+            // Splitting the dimensions in turn interleaves the bits of the coordinates
+            while (!dimensions::is_divisible(r.my_range, axis)) {
+                axis = (axis + 1) % num_dims;
+            }
+            my_range = split_half(r.my_range, axis, false, split_obj);
+            r.orient(entry, (axis + 1) % num_dims, num_dims, false);
+            orient(entry, (axis + 1) % num_dims, num_dims, false);
+            return;
+        }
+
+        if (r.my_pending != num_dims) {
+            // The second split of a quadrant step: the first quadrant of each pair lies at the entry
+            // side of the other dimension for the first pair and at the opposite side for the last one
+            unsigned other = r.my_pending;
+            bool last = r.my_last_quadrants;
+            my_range = split_half(r.my_range, other, bit(entry, other) != last, split_obj);
+            if (!last) {
+                r.orient(entry, other, num_dims, false);
+                orient(entry, axis, num_dims, false);
+            } else {
+                r.orient(entry, axis, num_dims, false);
+                orient(entry ^ (1u << axis) ^ (1u << other), other, num_dims, false);
+            }
+            return;
+        }
+
+        unsigned other = longest_dimension(r.my_range, axis);
+        if (!dimensions::is_divisible(r.my_range, axis)) {
+            // The subrange is too thin to turn in; the curve jumps at its end
+            axis = other;
+            other = num_dims;
+        }
+        bool cut_across = other == num_dims ||
+                          dimensions::extent(r.my_range, axis) >= 2 * dimensions::extent(r.my_range, other);
+        my_range = split_half(r.my_range, axis, bit(entry, axis), split_obj);
+        if (cut_across) {
+            r.orient(entry, axis, num_dims, false);
+            orient(entry, axis, num_dims, false);
+        } else {
+            r.orient(entry, axis, other, false);
+            orient(entry, axis, other, true);
+        }
+    }
+
+    //! Leaves the first half in r and returns the second one
+    static Range split_half( Range& r, unsigned d, bool upper_first, split& split_obj ) {
+        Range upper = dimensions::split(r, d, split_obj);
+        return upper_first ? swap_halves(r, upper) : upper;
+    }
+    static Range split_half( Range& r, unsigned d, bool upper_first, proportional_split& proportion ) {
+        if (!upper_first) {
+            return dimensions::split(r, d, proportion);
+        }
+        // The upper part receives the left share of the proportion
+        proportional_split swapped(proportion.right(), proportion.left());
+        Range upper = dimensions::split(r, d, swapped);
+        return swap_halves(r, upper);
+    }
+    static Range swap_halves( Range& r, Range& upper ) {
+        Range lower = r;
+        r = upper;
+        return lower;
+    }
+};
+
+//! Returns the range that visits its subranges along the Hilbert curve
+template <typename Range>
+space_filling_range<Range, space_filling_curve::hilbert> hilbert_order( const Range& range ) {
+    return space_filling_range<Range, space_filling_curve::hilbert>(range);
+}
+
+//! Returns the range that visits its subranges in Z-order
+template <typename Range>
+space_filling_range<Range, space_filling_curve::morton> morton_order( const Range& range ) {
+    return space_filling_range<Range, space_filling_curve::morton>(range);
+}
+
+} // namespace d1
+} // namespace detail
+
+inline namespace v1 {
+using detail::d1::space_filling_curve;
+using detail::d1::space_filling_range;
+using detail::d1::hilbert_order;
+using detail::d1::morton_order;
+} // namespace v1
+
+} // namespace tbb
+
+#endif /* __TBB_space_filling_range_H */
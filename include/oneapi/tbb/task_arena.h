@@ -35,6 +35,23 @@
 
 #include "task_group.h"
 
+#if __TBB_PREVIEW_ARENA_WARM_UP
+#include <chrono>
+#if _WIN32 || _WIN64
+#ifndef NOMINMAX
+#define NOMINMAX
+#define __TBB_DEFINED_NOMINMAX 1
+#endif
+#include <windows.h>
+#if __TBB_DEFINED_NOMINMAX
+#undef NOMINMAX
+#undef __TBB_DEFINED_NOMINMAX
+#endif
+#else
+#include <unistd.h>
+#endif
+#endif
+
 namespace tbb {
 namespace detail {
 
@@ -201,10 +218,23 @@ protected:
     }
 #endif
 
+#if __TBB_PREVIEW_ARENA_WEIGHTS
+    unsigned get_weight() const {
+        return unsigned((my_version_and_traits & weight_traits_mask) >> weight_traits_shift);
+    }
+
+    void set_weight_trait(unsigned w) {
+        my_version_and_traits = (my_version_and_traits & ~intptr_t(weight_traits_mask)) | (intptr_t(w) << weight_traits_shift);
+    }
+#endif
+
     enum {
         default_flags               = 0,
         core_type_support_flag      = 1,
-        fast_leave_policy_flag      = 1 << 1
+        fast_leave_policy_flag      = 1 << 1,
+        // Bits [8, 24) keep the arena weight; zero means that the weight is not specified
+        weight_traits_shift         = 8,
+        weight_traits_mask          = 0xFFFF << weight_traits_shift
     };
 
     task_arena_base(int max_concurrency, unsigned reserved_for_masters, priority a_priority
@@ -288,6 +318,103 @@ void enqueue_impl(F&& f, task_arena_base* ta) {
     small_object_allocator alloc{};
     r1::enqueue(*alloc.new_object<enqueue_task<typename std::decay<F>::type>>(std::forward<F>(f), alloc), ta);
 }
+
+#if __TBB_PREVIEW_ARENA_WARM_UP
+//! The point where the calling thread waits for the worker threads during the warm-up
+class warm_up_rendezvous : no_copy {
+    std::atomic<int> my_arrived{0};
+    const int my_expected;
+    const std::chrono::steady_clock::time_point my_deadline;
+public:
+    wait_context my_wait_ctx;
+
+    warm_up_rendezvous(int num_workers)
+        : my_expected(num_workers + 1)
+        // Bounds the warm-up when the workers are not available, e.g. limited by global_control
+        , my_deadline(std::chrono::steady_clock::now() + std::chrono::seconds(1))
+        , my_wait_ctx(std::uint32_t(num_workers))
+    {}
+
+    //! Returns the number of threads that met at the rendezvous including the calling one
+    int arrive_and_wait() {
+        int arrived = my_arrived.fetch_add(1) + 1;
+        for (atomic_backoff backoff; arrived < my_expected; arrived = my_arrived.load(std::memory_order_acquire)) {
+            if (std::chrono::steady_clock::now() >= my_deadline) {
+                break;
+            }
+            backoff.pause();
+        }
+        return arrived < my_expected ? arrived : my_expected;
+    }
+};
+
+inline std::size_t warm_up_page_size() {
+#if _WIN32 || _WIN64
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    return si.dwPageSize;
+#else
+    return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+class warm_up_task : public task {
+    warm_up_rendezvous& my_rendezvous;
+    small_object_allocator my_allocator;
+
+    void finalize(const execution_data& ed) {
+        warm_up_rendezvous& rendezvous = my_rendezvous;
+        my_allocator.delete_object(this, ed);
+        rendezvous.my_wait_ctx.release();
+    }
+    //! Touches the per-thread resources that are otherwise initialized by the first real task
+    void warm_up_thread_resources(execution_data& ed) {
+        // Commit the top pages of the thread stack
+        constexpr std::size_t stack_bytes = 16 * 1024;
+        static const std::size_t page_bytes = warm_up_page_size();
+        volatile char stack_buffer[stack_bytes];
+        for (std::size_t i = 0; i < stack_bytes; i += page_bytes) {
+            stack_buffer[i] = 0;
+        }
+        suppress_unused_warning(stack_buffer);
+        // Populate the small object pool of the thread
+        small_object_allocator alloc{};
+        alloc.delete_object(alloc.new_object<warm_up_task>(ed, my_rendezvous, alloc), ed);
+    }
+    task* execute(execution_data& ed) override {
+        warm_up_thread_resources(ed);
+        my_rendezvous.arrive_and_wait();
+        finalize(ed);
+        return nullptr;
+    }
+    task* cancel(execution_data& ed) override {
+        finalize(ed);
+        return nullptr;
+    }
+public:
+    warm_up_task(warm_up_rendezvous& rendezvous, small_object_allocator& alloc)
+        : my_rendezvous(rendezvous), my_allocator(alloc) {}
+};
+
+//! Brings num_workers worker threads into the current arena and keeps them there until all of them arrive
+/** Returns the number of worker threads that arrived before the timeout. */
+inline int warm_up_impl(int num_workers) {
+    if (num_workers <= 0) {
+        return 0;
+    }
+    warm_up_rendezvous rendezvous(num_workers);
+    task_group_context context(ALGORITHM);
+    small_object_allocator alloc{};
+    for (int i = 0; i < num_workers; ++i) {
+        spawn(*alloc.new_object<warm_up_task>(rendezvous, alloc), context);
+    }
+    // The calling thread waits outside of the dispatch loop, so the spawned tasks are left to the workers
+    int arrived = rendezvous.arrive_and_wait();
+    // Tasks that were not taken before the timeout run (and leave at once) here
+    wait(rendezvous.my_wait_ctx, context);
+    return arrived - 1;
+}
+#endif /*__TBB_PREVIEW_ARENA_WARM_UP*/
 /** 1-to-1 proxy representation class of scheduler's arena
  * Constructors set up settings only, real construction is deferred till the first method invocation
  * Destructor only removes one of the references to the inner arena representation.
@@ -364,8 +491,11 @@ public:
             , a.get_leave_policy()
 #endif
         )
-    
-    {}
+    {
+#if __TBB_PREVIEW_ARENA_WEIGHTS
+        set_weight_trait(a.get_weight());
+#endif
+    }
 #else
     //! Copies settings from another task_arena
     task_arena(const task_arena& a) // copy settings but not the reference or instance
@@ -376,7 +506,11 @@ public:
                           a.get_leave_policy()
 #endif
           )
-    {}
+    {
+#if __TBB_PREVIEW_ARENA_WEIGHTS
+        set_weight_trait(a.get_weight());
+#endif
+    }
 #endif /*__TBB_ARENA_BINDING*/
 
     //! Tag class used to indicate the "attaching" constructor
@@ -489,6 +623,26 @@ public:
         return my_initialization_state.load(std::memory_order_acquire) == do_once_state::initialized;
     }
 
+#if __TBB_PREVIEW_ARENA_WEIGHTS
+    //! The largest weight that can be assigned to an arena
+    static const unsigned max_weight = 0xFFFF;
+
+    //! Sets the share of workers the arena is guaranteed under contention with other arenas of the same priority.
+    /** Workers are divided among such arenas in proportion to their weights; the share that an arena does not
+        use is redistributed among the others. Must be called before the arena is initialized. **/
+    void set_weight(unsigned w) {
+        __TBB_ASSERT(!my_arena.load(std::memory_order_relaxed), "Impossible to modify settings of an already initialized task_arena");
+        __TBB_ASSERT(0 < w && w <= max_weight, "The arena weight is out of range");
+        set_weight_trait(w);
+    }
+
+    //! Returns the weight of the arena; arenas with unspecified weight have the weight of 1.
+    unsigned weight() const {
+        unsigned w = get_weight();
+        return w ? w : 1;
+    }
+#endif
+
     //! Enqueues a task into the arena to process a functor, and immediately returns.
     //! Does not require the calling thread to join the arena
 
@@ -530,6 +684,21 @@ public:
         return execute_impl<decltype(f())>(f);
     }
 
+#if __TBB_PREVIEW_ARENA_WARM_UP
+    //! Initializes the arena and brings worker threads into it ahead of the first parallel work
+    /** Blocks until num_workers worker threads have joined the arena or the warm-up timeout is over.
+        Returns the number of worker threads that joined. */
+    int warm_up(int num_workers = automatic) {
+        initialize();
+        int reserved = my_num_reserved_slots > 1 ? int(my_num_reserved_slots) : 1;
+        int max_workers = max_concurrency() - reserved;
+        if (num_workers == automatic || num_workers > max_workers) {
+            num_workers = max_workers;
+        }
+        return execute([num_workers] { return warm_up_impl(num_workers); });
+    }
+#endif
+
 #if __TBB_PREVIEW_PARALLEL_PHASE
     void start_parallel_phase() {
         initialize();
@@ -584,6 +753,14 @@ public:
         return (my_max_concurrency > 1) ? my_max_concurrency : r1::max_concurrency(this);
     }
 
+#if __TBB_PREVIEW_FLOW_GRAPH_NODE_ARENAS
+    //! Returns the number of slots of the initialized arena that are not reserved for external threads
+    friend int num_worker_slots(const task_arena& ta) {
+        int slots = ta.max_concurrency() - int(ta.my_num_reserved_slots);
+        return slots > 0 ? slots : 0;
+    }
+#endif
+
     friend void submit(task& t, task_arena& ta, task_group_context& ctx, bool as_critical) {
         __TBB_ASSERT(ta.is_active(), nullptr);
         call_itt_task_notify(releasing, &t);
@@ -629,6 +806,17 @@ inline void enqueue(F&& f, d2::task_group& tg) {
     d2::enqueue_impl(tg.defer(std::forward<F>(f)), nullptr);
 }
 
+#if __TBB_PREVIEW_ARENA_WARM_UP
+//! Brings worker threads into the current arena ahead of the first parallel work
+inline int warm_up(int num_workers = task_arena_base::automatic) {
+    int max_workers = max_concurrency() - 1;
+    if (num_workers == task_arena_base::automatic || num_workers > max_workers) {
+        num_workers = max_workers;
+    }
+    return warm_up_impl(num_workers);
+}
+#endif
+
 #if __TBB_PREVIEW_PARALLEL_PHASE
 inline void start_parallel_phase() {
     r1::enter_parallel_phase(nullptr, /*reserved*/0);
@@ -660,6 +848,10 @@ using detail::d1::isolate;
 
 using detail::d1::enqueue;
 
+#if __TBB_PREVIEW_ARENA_WARM_UP
+using detail::d1::warm_up;
+#endif
+
 #if __TBB_PREVIEW_PARALLEL_PHASE
 using detail::d1::start_parallel_phase;
 using detail::d1::end_parallel_phase;
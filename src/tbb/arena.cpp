@@ -30,6 +30,12 @@
 #include <cstring>
 #include <functional>
 
+#if _WIN32 || _WIN64
+#include <windows.h>
+#elif __unix__ || __APPLE__
+#include <sys/mman.h>
+#endif
+
 namespace tbb {
 namespace detail {
 namespace r1 {
@@ -176,6 +182,7 @@ std::size_t arena::occupy_free_slot(thread_data& tls) {
             return out_of_arena;
     }
 
+    materialize_slot(index);
     atomic_update( my_limit, (unsigned)(index + 1), std::less<unsigned>() );
     return index;
 }
@@ -265,17 +272,10 @@ arena::arena(threading_control* control, unsigned num_slots, unsigned num_reserv
     // Initialize the default context. It should be allocated before task_dispatch construction.
     my_default_ctx = new (cache_aligned_allocate(sizeof(d1::task_group_context)))
         d1::task_group_context{ d1::task_group_context::isolated, d1::task_group_context::fp_settings };
-    // Construct slots. Mark internal synchronization elements for the tools.
-    task_dispatcher* base_td_pointer = reinterpret_cast<task_dispatcher*>(my_slots + my_num_slots);
-    for( unsigned i = 0; i < my_num_slots; ++i ) {
-        // __TBB_ASSERT( !my_slots[i].my_scheduler && !my_slots[i].task_pool, nullptr);
-        __TBB_ASSERT( !my_slots[i].task_pool_ptr, nullptr);
-        __TBB_ASSERT( !my_slots[i].my_task_pool_size, nullptr);
-        mailbox(i).construct();
-        my_slots[i].init_task_streams(i);
-        my_slots[i].my_default_task_dispatcher = new(base_td_pointer + i) task_dispatcher(this);
-        my_slots[i].my_is_occupied.store(false, std::memory_order_relaxed);
-    }
+    // Slots, mailboxes and task dispatchers live in zeroed memory and are materialized when the slot
+    // is occupied for the first time, so the unused part of a large arena does not consume memory.
+    // The first slot is used by the external thread in most cases.
+    materialize_slot(0);
     my_fifo_task_stream.initialize(my_num_slots);
     my_resume_task_stream.initialize(my_num_slots);
 #if __TBB_CRITICAL_TASKS
@@ -299,9 +299,7 @@ arena& arena::allocate_arena(threading_control* control, unsigned num_slots, uns
     __TBB_ASSERT( sizeof(base_type) % cache_line_size() == 0, "arena slots area misaligned: wrong padding" );
     __TBB_ASSERT( sizeof(mail_outbox) == max_nfs_size, "Mailbox padding is wrong" );
     std::size_t n = allocation_size(num_arena_slots(num_slots, num_reserved_slots));
-    unsigned char* storage = (unsigned char*)cache_aligned_allocate(n);
-    // Zero all slots to indicate that they are empty
-    std::memset( storage, 0, n );
+    unsigned char* storage = (unsigned char*)allocate_storage(n);
 
     return *new( storage + num_arena_slots(num_slots, num_reserved_slots) * sizeof(mail_outbox) )
         arena(control, num_slots, num_reserved_slots, priority_level
@@ -330,7 +328,9 @@ void arena::free_arena () {
         __TBB_ASSERT( my_slots[i].head == my_slots[i].tail, nullptr); // TODO: replace by is_quiescent_local_task_pool_empty
         my_slots[i].free_task_pool();
         mailbox(i).drain();
-        my_slots[i].my_default_task_dispatcher->~task_dispatcher();
+        if (my_slots[i].my_default_task_dispatcher) {
+            my_slots[i].my_default_task_dispatcher->~task_dispatcher();
+        }
     }
     __TBB_ASSERT(my_fifo_task_stream.empty(), "Not all enqueued tasks were executed");
     __TBB_ASSERT(my_resume_task_stream.empty(), "Not all enqueued tasks were executed");
@@ -350,7 +350,61 @@ void arena::free_arena () {
 #if TBB_USE_ASSERT > 1
     std::memset( storage, 0, allocation_size(my_num_slots) );
 #endif /* TBB_USE_ASSERT */
-    cache_aligned_deallocate( storage );
+    deallocate_storage( storage, allocation_size(my_num_slots) );
+}
+
+void* arena::allocate_storage(std::size_t n) {
+    void* storage = nullptr;
+    if (n >= lazy_commit_threshold) {
+        // Reserve zero-filled pages that are committed by the OS on first touch
+#if _WIN32 || _WIN64
+        storage = VirtualAlloc(nullptr, n, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+        if (!storage) {
+            throw_exception(exception_id::bad_alloc);
+        }
+#elif __unix__ || __APPLE__
+        storage = mmap(nullptr, n, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (storage == MAP_FAILED) {
+            throw_exception(exception_id::bad_alloc);
+        }
+#endif
+    }
+    if (!storage) {
+        storage = cache_aligned_allocate(n);
+        // Zero all slots to indicate that they are empty
+        std::memset(storage, 0, n);
+    }
+    __TBB_ASSERT(is_aligned(storage, cache_line_size()), nullptr);
+    return storage;
+}
+
+void arena::deallocate_storage(void* storage, std::size_t n) {
+#if _WIN32 || _WIN64
+    if (n >= lazy_commit_threshold) {
+        VirtualFree(storage, 0, MEM_RELEASE);
+        return;
+    }
+#elif __unix__ || __APPLE__
+    if (n >= lazy_commit_threshold) {
+        munmap(storage, n);
+        return;
+    }
+#endif
+    suppress_unused_warning(n);
+    cache_aligned_deallocate(storage);
+}
+
+void arena::materialize_slot(std::size_t index) {
+    arena_slot& slot = my_slots[index];
+    // Only the thread occupying the slot can get here, so no synchronization is needed
+    if (!slot.my_default_task_dispatcher) {
+        __TBB_ASSERT(!slot.task_pool_ptr, nullptr);
+        __TBB_ASSERT(!slot.my_task_pool_size, nullptr);
+        // The mailbox does not need construction: it treats the zeroed state as empty
+        slot.init_task_streams(unsigned(index));
+        task_dispatcher* base_td_pointer = reinterpret_cast<task_dispatcher*>(my_slots + my_num_slots);
+        slot.my_default_task_dispatcher = new(base_td_pointer + index) task_dispatcher(this);
+    }
 }
 
 bool arena::has_enqueued_tasks() {
@@ -401,7 +455,10 @@ void arena::out_of_work() {
 }
 
 void arena::set_top_priority(bool is_top_priority) {
-    my_is_top_priority.store(is_top_priority, std::memory_order_relaxed);
+    if (my_is_top_priority.load(std::memory_order_relaxed) != is_top_priority) {
+        my_is_top_priority.store(is_top_priority, std::memory_order_relaxed);
+        my_allotment_epoch.fetch_add(1, std::memory_order_relaxed);
+    }
 }
 
 bool arena::is_top_priority() const {
@@ -419,6 +476,7 @@ bool arena::try_join() {
 void arena::set_allotment(unsigned allotment) {
     if (my_num_workers_allotted.load(std::memory_order_relaxed) != allotment) {
         my_num_workers_allotted.store(allotment, std::memory_order_relaxed);
+        my_allotment_epoch.fetch_add(1, std::memory_order_relaxed);
     }
 }
 
@@ -426,6 +484,7 @@ int arena::update_concurrency(unsigned allotment) {
     int delta = allotment - my_num_workers_allotted.load(std::memory_order_relaxed);
     if (delta != 0) {
         my_num_workers_allotted.store(allotment, std::memory_order_relaxed);
+        my_allotment_epoch.fetch_add(1, std::memory_order_relaxed);
     }
     return delta;
 }
@@ -467,6 +526,9 @@ arena &arena::create(threading_control *control, unsigned num_slots,
 #if __TBB_PREVIEW_PARALLEL_PHASE
                      , tbb::task_arena::leave_policy lp 
 #endif
+#if __TBB_PREVIEW_ARENA_WEIGHTS
+                     , unsigned weight
+#endif
 ) {
     __TBB_ASSERT(num_slots > 0, NULL);
     __TBB_ASSERT(num_reserved_slots <= num_slots, NULL);
@@ -476,6 +538,10 @@ arena &arena::create(threading_control *control, unsigned num_slots,
                                      , lp
 #endif
     );
+#if __TBB_PREVIEW_ARENA_WEIGHTS
+    // The weight is read by the permit manager, so it has to be set before the arena is published
+    a.my_weight = weight;
+#endif
     a.my_tc_client = control->create_client(a);
     // We should not publish arena until all fields are initialized
     control->publish_client(a.my_tc_client, constraints);
@@ -610,6 +676,9 @@ void task_arena_impl::initialize(d1::task_arena_base& ta) {
                              priority_level, arena_constraints
 #if __TBB_PREVIEW_PARALLEL_PHASE
                              , ta.get_leave_policy()
+#endif
+#if __TBB_PREVIEW_ARENA_WEIGHTS
+                             , ta.get_weight()
 #endif
     );
 
@@ -642,6 +711,9 @@ bool task_arena_impl::attach(d1::task_arena_base& ta) {
         a->my_references += arena::ref_external;
         ta.my_num_reserved_slots = a->my_num_reserved_slots;
         ta.my_priority = arena_priority(a->my_priority_level);
+#if __TBB_PREVIEW_ARENA_WEIGHTS
+        ta.set_weight_trait(a->my_weight);
+#endif
         ta.my_max_concurrency = ta.my_num_reserved_slots + a->my_max_num_workers;
         __TBB_ASSERT(arena::num_arena_slots(ta.my_max_concurrency, ta.my_num_reserved_slots) == a->my_num_slots, nullptr);
         ta.my_arena.store(a, std::memory_order_release);
@@ -255,6 +255,10 @@ struct arena_base : padded<intrusive_list_node> {
     //! The number of workers that have been marked out by the resource manager to service the arena.
     std::atomic<unsigned> my_num_workers_allotted;   // heavy use in stealing loop
 
+    //! Incremented whenever the allotment or the top priority status of the arena changes.
+    /** Lets workers detect a possible recall with a single load at task boundaries. **/
+    std::atomic<unsigned> my_allotment_epoch{0};     // heavy use in dispatch loop
+
     //! Reference counter for the arena.
     /** Worker and external thread references are counted separately: first several bits are for references
         from external thread threads or explicit task_arenas (see arena::ref_external_bits below);
@@ -289,6 +293,11 @@ struct arena_base : padded<intrusive_list_node> {
     //! The index in the array of per priority lists of arenas this object is in.
     /*const*/ unsigned my_priority_level;
 
+#if __TBB_PREVIEW_ARENA_WEIGHTS
+    //! Share of workers relative to other arenas of the same priority level, zero if not specified.
+    /*const*/ unsigned my_weight;
+#endif
+
     //! The max priority level of arena in permit manager.
     std::atomic<bool> my_is_top_priority{false};
 
@@ -373,6 +382,9 @@ public:
                          d1::constraints constraints = d1::constraints{}
 #if __TBB_PREVIEW_PARALLEL_PHASE
                          , tbb::task_arena::leave_policy lp = tbb::task_arena::leave_policy::automatic
+#endif
+#if __TBB_PREVIEW_ARENA_WEIGHTS
+                         , unsigned weight = 0
 #endif
     );
 
@@ -394,6 +406,19 @@ public:
     //! Completes arena shutdown, destructs and deallocates it.
     void free_arena();
 
+    //! Arenas of at least this size are allocated directly from the OS, so that the memory of
+    //! slots that are never occupied is not committed.
+    static constexpr std::size_t lazy_commit_threshold = 32 * 1024;
+
+    //! Allocates zeroed memory for an arena
+    static void* allocate_storage(std::size_t n);
+
+    //! Frees memory allocated by allocate_storage
+    static void deallocate_storage(void* storage, std::size_t n);
+
+    //! Prepares a slot for its first use; must be called by the thread occupying the slot
+    void materialize_slot(std::size_t index);
+
     //! The number of least significant bits for external references
     static const unsigned ref_external_bits = 12; // up to 4095 external and 1M workers
 
@@ -462,6 +487,10 @@ public:
 
     unsigned priority_level() { return my_priority_level; }
 
+#if __TBB_PREVIEW_ARENA_WEIGHTS
+    unsigned weight() const { return my_weight; }
+#endif
+
     bool has_request() { return my_total_num_workers_requested; }
 
     unsigned references() const { return my_references.load(std::memory_order_acquire); }
@@ -25,6 +25,8 @@
 #include "concurrent_monitor.h"
 #include "thread_dispatcher.h"
 #include "load_tbbbind.h"
+#include "sysfs_topology.h"
+#include "environment.h"
 
 #include "oneapi/tbb/task_group.h"
 #include "oneapi/tbb/global_control.h"
@@ -434,6 +436,92 @@ static const dynamic_link_descriptor TbbBindLinkTable[] = {
 static const unsigned LinkTableSize = sizeof(TbbBindLinkTable) / sizeof(dynamic_link_descriptor);
 #endif /* _WIN32 || _WIN64 || __unix__ || __APPLE__ */
 
+#if __TBB_SYSFS_TOPOLOGY_PRESENT
+// Native Linux replacement of the TBBbind API used when TBBbind (or hwloc) cannot be loaded.
+// Enabled with the TBB_ENABLE_SYSFS_TOPOLOGY environment variable.
+namespace sysfs_binding {
+static sysfs_topology* topology_ptr = nullptr;
+
+static bool try_construct_topology() {
+    cpu_mask process_mask;
+    if (!cpu_mask::get_thread_affinity(process_mask)) {
+        return false;
+    }
+    void* storage = allocate_memory(sizeof(sysfs_topology));
+    topology_ptr = new (storage) sysfs_topology();
+    if (!topology_ptr->parse(process_mask)) {
+        topology_ptr->~sysfs_topology();
+        deallocate_memory(storage);
+        topology_ptr = nullptr;
+        return false;
+    }
+    return true;
+}
+
+static void initialize_system_topology(
+    size_t /*groups_num*/,
+    int& numa_nodes_count, int*& numa_indexes_list,
+    int& core_types_count, int*& core_types_indexes_list
+) {
+    __TBB_ASSERT(topology_ptr, "sysfs topology is not constructed");
+    numa_nodes_count = int(topology_ptr->numa_indexes().size());
+    numa_indexes_list = const_cast<int*>(topology_ptr->numa_indexes().data());
+    core_types_count = int(topology_ptr->core_type_indexes().size());
+    core_types_indexes_list = const_cast<int*>(topology_ptr->core_type_indexes().data());
+}
+
+static void destroy_system_topology() {
+    if (topology_ptr) {
+        topology_ptr->~sysfs_topology();
+        deallocate_memory(topology_ptr);
+        topology_ptr = nullptr;
+    }
+}
+
+static binding_handler* allocate_binding_handler(int slot_num, int numa_id, int core_type_id, int max_threads_per_core) {
+    __TBB_ASSERT(slot_num > 0, "Trying to create numa handler for 0 threads.");
+    void* storage = allocate_memory(sizeof(sysfs_binding_handler));
+    auto handler = new (storage) sysfs_binding_handler(*topology_ptr, slot_num, numa_id, core_type_id, max_threads_per_core);
+    return reinterpret_cast<binding_handler*>(handler);
+}
+
+static void deallocate_binding_handler(binding_handler* handler_ptr) {
+    __TBB_ASSERT(handler_ptr != nullptr, "Trying to deallocate nullptr pointer.");
+    auto handler = reinterpret_cast<sysfs_binding_handler*>(handler_ptr);
+    handler->~sysfs_binding_handler();
+    deallocate_memory(handler);
+}
+
+static void apply_affinity(binding_handler* handler_ptr, int slot_num) {
+    __TBB_ASSERT(handler_ptr != nullptr, "Trying to get access to uninitialized metadata.");
+    reinterpret_cast<sysfs_binding_handler*>(handler_ptr)->apply_affinity(slot_num);
+}
+
+static void restore_affinity(binding_handler* handler_ptr, int slot_num) {
+    __TBB_ASSERT(handler_ptr != nullptr, "Trying to get access to uninitialized metadata.");
+    reinterpret_cast<sysfs_binding_handler*>(handler_ptr)->restore_affinity(slot_num);
+}
+
+static int get_default_concurrency(int numa_id, int core_type_id, int max_threads_per_core) {
+    return topology_ptr->default_concurrency(numa_id, core_type_id, max_threads_per_core);
+}
+
+static bool try_link() {
+    if (!GetBoolEnvironmentVariable("TBB_ENABLE_SYSFS_TOPOLOGY") || !try_construct_topology()) {
+        return false;
+    }
+    initialize_system_topology_ptr = initialize_system_topology;
+    destroy_system_topology_ptr = destroy_system_topology;
+    allocate_binding_handler_ptr = allocate_binding_handler;
+    deallocate_binding_handler_ptr = deallocate_binding_handler;
+    apply_affinity_ptr = apply_affinity;
+    restore_affinity_ptr = restore_affinity;
+    get_default_concurrency_ptr = get_default_concurrency;
+    return true;
+}
+} // namespace sysfs_binding
+#endif /* __TBB_SYSFS_TOPOLOGY_PRESENT */
+
 // Representation of system hardware topology information on the TBB side.
 // System topology may be initialized by third-party component (e.g. hwloc)
 // or just filled in with default stubs.
@@ -501,6 +589,20 @@ void initialization_impl() {
         return;
     }
 
+#if __TBB_SYSFS_TOPOLOGY_PRESENT
+    if (sysfs_binding::try_link()) {
+        initialize_system_topology_ptr(
+            processor_groups_num(),
+            numa_nodes_count, numa_nodes_indexes,
+            core_types_count, core_types_indexes
+        );
+
+        PrintExtraVersionInfo("TBBBIND", "UNAVAILABLE");
+        PrintExtraVersionInfo("TOPOLOGY", "sysfs");
+        return;
+    }
+#endif /* __TBB_SYSFS_TOPOLOGY_PRESENT */
+
     static int dummy_index = automatic;
 
     numa_nodes_count = 1;
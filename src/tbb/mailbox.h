@@ -100,7 +100,8 @@ protected:
     //! Pointer to first task_proxy in mailbox, or nullptr if box is empty.
     atomic_proxy_ptr my_first;
 
-    //! Pointer to pointer that will point to next item in the queue.  Never nullptr.
+    //! Pointer to pointer that will point to next item in the queue.
+    /** nullptr until the first push, which is equivalent to pointing to my_first. **/
     std::atomic<atomic_proxy_ptr*> my_last;
 
     //! Owner of mailbox is not executing a task, and has drained its own task pool.
@@ -159,7 +160,11 @@ public:
     void push( task_proxy* t ) {
         assert_pointer_valid(t);
         t->next_in_mailbox.store(nullptr, std::memory_order_relaxed);
-        atomic_proxy_ptr* const link = my_last.exchange(&t->next_in_mailbox);
+        atomic_proxy_ptr* link = my_last.exchange(&t->next_in_mailbox);
+        if (!link) {
+            // The mailbox was never used, its zeroed state is equivalent to the empty one
+            link = &my_first;
+        }
         // Logically, the release fence is not required because the exchange above provides the
         // release-acquire semantic that guarantees that (*t) will be consistent when another thread
         // loads the link atomic. However, C++11 memory model guarantees consistency of(*t) only
@@ -172,19 +177,6 @@ public:
         return my_first.load(std::memory_order_relaxed) == nullptr;
     }
 
-    //! Construct *this as a mailbox from zeroed memory.
-    /** Raise assertion if *this is not previously zeroed, or sizeof(this) is wrong.
-        This method is provided instead of a full constructor since we know the object
-        will be constructed in zeroed memory. */
-    void construct() {
-        __TBB_ASSERT( sizeof(*this)==max_nfs_size, nullptr );
-        __TBB_ASSERT( !my_first.load(std::memory_order_relaxed), nullptr );
-        __TBB_ASSERT( !my_last.load(std::memory_order_relaxed), nullptr );
-        __TBB_ASSERT( !my_is_idle.load(std::memory_order_relaxed), nullptr );
-        my_last = &my_first;
-        suppress_unused_warning(pad);
-    }
-
     //! Drain the mailbox
     void drain() {
         // No fences here because other threads have already quit.
@@ -17,7 +17,8 @@
 #include "arena.h"
 #include "market.h"
 
-#include <algorithm> // std::find
+#include <algorithm> // std::find, std::any_of
+#include <cstdint>
 
 namespace tbb {
 namespace detail {
@@ -35,6 +36,11 @@ public:
     void set_allotment(unsigned allotment) {
         my_arena.set_allotment(allotment);
     }
+
+#if __TBB_PREVIEW_ARENA_WEIGHTS
+    //! Allotment being computed by the weighted distribution
+    int my_weighted_allotment{0};
+#endif
 };
 
 //------------------------------------------------------------------------
@@ -80,6 +86,14 @@ void market::update_allotment() {
     for (unsigned list_idx = 0; list_idx < num_priority_levels; ++list_idx ) {
         int assigned_per_priority = min(my_priority_level_demand[list_idx], unassigned_workers);
         unassigned_workers -= assigned_per_priority;
+#if __TBB_PREVIEW_ARENA_WEIGHTS
+        bool is_weighted = my_num_workers_soft_limit != 0 && assigned_per_priority > 0 &&
+            std::any_of(my_clients[list_idx].begin(), my_clients[list_idx].end(),
+                [](pm_client* c) { return c->weight() != 0; });
+        if (is_weighted) {
+            distribute_by_weight(my_clients[list_idx], assigned_per_priority);
+        }
+#endif
         // We use reverse iterator there to serve last added clients first
         for (auto it = my_clients[list_idx].rbegin(); it != my_clients[list_idx].rend(); ++it) {
             tbb_permit_manager_client& client = static_cast<tbb_permit_manager_client&>(**it);
@@ -96,6 +110,10 @@ void market::update_allotment() {
             if (my_num_workers_soft_limit == 0) {
                 __TBB_ASSERT(max_workers == 0 || max_workers == 1, nullptr);
                 allotted = client.min_workers() > 0 && assigned < max_workers ? 1 : 0;
+#if __TBB_PREVIEW_ARENA_WEIGHTS
+            } else if (is_weighted) {
+                allotted = client.my_weighted_allotment;
+#endif
             } else {
                 int tmp = client.max_workers() * assigned_per_priority + carry;
                 allotted = tmp / my_priority_level_demand[list_idx];
@@ -110,6 +128,48 @@ void market::update_allotment() {
     __TBB_ASSERT(assigned == max_workers, nullptr);
 }
 
+#if __TBB_PREVIEW_ARENA_WEIGHTS
+void market::distribute_by_weight(clients_container_type& clients, int num_workers) {
+    // Water-filling: each round splits the remaining workers in proportion to the weights of the clients
+    // that still need workers. A client that gets more than it requested is capped and the excess goes
+    // to the next round, so the share of an idle arena is borrowed by the busy ones.
+    for (pm_client* c : clients) {
+        static_cast<tbb_permit_manager_client*>(c)->my_weighted_allotment = 0;
+    }
+    int remaining = num_workers;
+    while (remaining > 0) {
+        std::uint64_t total_weight = 0;
+        for (pm_client* c : clients) {
+            auto& client = *static_cast<tbb_permit_manager_client*>(c);
+            if (client.my_weighted_allotment < client.max_workers()) {
+                total_weight += client.weight() ? client.weight() : 1;
+            }
+        }
+        __TBB_ASSERT(total_weight > 0, "The level demand is less than the number of workers to distribute");
+
+        int distributed = 0;
+        std::uint64_t carry = 0;
+        // Serve last added clients first to be consistent with the unweighted distribution
+        for (auto it = clients.rbegin(); it != clients.rend(); ++it) {
+            auto& client = static_cast<tbb_permit_manager_client&>(**it);
+            int need = client.max_workers() - client.my_weighted_allotment;
+            if (need <= 0) {
+                continue;
+            }
+            std::uint64_t tmp = std::uint64_t(client.weight() ? client.weight() : 1) * remaining + carry;
+            int share = int(tmp / total_weight);
+            carry = tmp % total_weight;
+            int granted = min(share, need);
+            client.my_weighted_allotment += granted;
+            distributed += granted;
+        }
+        // Each round either distributes everything or saturates at least one client
+        __TBB_ASSERT(distributed > 0, nullptr);
+        remaining -= distributed;
+    }
+}
+#endif
+
 void market::set_active_num_workers(int soft_limit) {
     mutex_type::scoped_lock lock(my_mutex);
     if (my_num_workers_soft_limit != soft_limit) {
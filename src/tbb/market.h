@@ -48,6 +48,13 @@ private:
     //! Recalculates the number of workers assigned to each arena in the list.
     void update_allotment();
 
+    using clients_container_type = std::vector<pm_client*, tbb::tbb_allocator<pm_client*>>;
+
+#if __TBB_PREVIEW_ARENA_WEIGHTS
+    //! Divides the workers among the clients of a priority level in proportion to their weights.
+    void distribute_by_weight(clients_container_type& clients, int num_workers);
+#endif
+
     //! Keys for the arena map array. The lower the value the higher priority of the arena list.
     static constexpr unsigned num_priority_levels = d1::num_priority_levels;
 
@@ -67,7 +74,6 @@ private:
     int my_mandatory_num_requested{0};
 
     //! Per priority list of registered arenas
-    using clients_container_type = std::vector<pm_client*, tbb::tbb_allocator<pm_client*>>;
     clients_container_type my_clients[num_priority_levels];
 }; // class market
 
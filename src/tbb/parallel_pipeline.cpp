@@ -16,6 +16,7 @@
 
 #include "oneapi/tbb/parallel_pipeline.h"
 #include "oneapi/tbb/spin_mutex.h"
+#include "oneapi/tbb/task_arena.h"
 #include "oneapi/tbb/tbb_allocator.h"
 #include "oneapi/tbb/cache_aligned_allocator.h"
 #include "itt_notify.h"
@@ -35,6 +36,7 @@ using Token = unsigned long;
 /** @ingroup algorithms */
 class pipeline {
     friend void parallel_pipeline(d1::task_group_context&, std::size_t, const d1::filter_node&);
+    friend void parallel_pipeline(d1::task_group_context&, const d1::pipeline_limits&, const d1::filter_node&);
 public:
 
     //! Construct empty pipeline.
@@ -43,11 +45,25 @@ public:
         first_filter(nullptr),
         last_filter(nullptr),
         input_tokens(Token(max_token)),
+        extra_tokens(0),
+        my_max_bytes(0),
+        my_limits(nullptr),
+        bytes_in_flight(0),
+        input_stalled(false),
         end_of_input(false),
         wait_ctx(0) {
             __TBB_ASSERT( max_token>0, "pipeline::run must have at least one token" );
         }
 
+    //! Construct empty pipeline with adaptive number of tokens.
+    pipeline(d1::task_group_context& cxt, const d1::pipeline_limits& limits) :
+        pipeline(cxt, initial_tokens(limits))
+    {
+        extra_tokens.store(Token(limits.max_tokens()) - input_tokens.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        my_max_bytes = limits.max_bytes();
+        my_limits = &limits;
+    }
+
     ~pipeline();
 
     //! Add filter to end of pipeline.
@@ -81,10 +97,73 @@ private:
     //! Number of idle tokens waiting for input stage.
     std::atomic<Token> input_tokens;
 
+    //! Number of tokens that can still be added when the input stage runs out of tokens.
+    std::atomic<Token> extra_tokens;
+
+    //! Limit of bytes_in_flight, or zero if the bytes are not accounted.
+    std::size_t my_max_bytes;
+
+    //! Limits of the pipeline with adaptive number of tokens, or nullptr.
+    const d1::pipeline_limits* my_limits;
+
+    //! Total size of the items read by the input stage that have not left the pipeline yet.
+    std::atomic<std::size_t> bytes_in_flight;
+
+    //! True if the input stage stopped because of the byte limit while tokens were available.
+    std::atomic<bool> input_stalled;
+
     //! False until flow_control::stop() is called.
     std::atomic<bool> end_of_input;
 
     d1::wait_context wait_ctx;
+
+    static std::size_t initial_tokens(const d1::pipeline_limits& limits) {
+        std::size_t n = limits.initial_tokens();
+        if( n==0 )
+            n = std::size_t(max_concurrency(nullptr));
+        return n<limits.max_tokens() ? n : limits.max_tokens();
+    }
+
+    //! Takes one of the extra tokens; returns false if there are none left.
+    bool take_extra_token() {
+        Token n = extra_tokens.load(std::memory_order_relaxed);
+        while( n>0 && !extra_tokens.compare_exchange_weak(n, n-1, std::memory_order_relaxed) ) {}
+        return n>0;
+    }
+
+    //! Accounts the item read by the input stage; returns its size.
+    std::size_t charge_item(void* object) {
+        if( !my_max_bytes )
+            return 0;
+        std::size_t size = my_limits->item_size(object);
+        bytes_in_flight.fetch_add(size);
+        return size;
+    }
+
+    void release_item(std::size_t size) {
+        if( my_max_bytes )
+            bytes_in_flight.fetch_sub(size);
+    }
+
+    bool bytes_exceeded() const {
+        return my_max_bytes && bytes_in_flight.load()>=my_max_bytes;
+    }
+
+    //! Returns true if the input stage must stop because of the byte limit.
+    /** The caller holds a token for the next input stage task; the task is not spawned until
+        an item leaves the pipeline and resumes the input. */
+    bool stall_input() {
+        if( !bytes_exceeded() )
+            return false;
+        input_stalled.store(true);
+        // Items may have left the pipeline after the check and missed the flag.
+        return !try_resume_input();
+    }
+
+    //! Returns true if the caller must become the input stage task stopped by the byte limit.
+    bool try_resume_input() {
+        return input_stalled.load() && !bytes_exceeded() && input_stalled.exchange(false);
+    }
 };
 
 //! This structure is used to store task information in an input buffer
@@ -96,12 +175,15 @@ struct task_info {
     bool my_token_ready  = false;
     //! True if my_object is valid.
     bool is_valid = false;
+    //! Size of the item accounted against the byte limit of the pipeline.
+    std::size_t my_bytes = 0;
     //! Set to initial state (no object, no token)
     void reset() {
         my_object = nullptr;
         my_token = 0;
         my_token_ready = false;
         is_valid = false;
+        my_bytes = 0;
     }
 };
 
@@ -280,7 +362,15 @@ private:
     //! Spawn task if token is available.
     void try_spawn_stage_task(d1::execution_data& ed) {
         ITT_NOTIFY( sync_releasing, &my_pipeline.input_tokens );
-        if( (my_pipeline.input_tokens.fetch_sub(1, std::memory_order_release)) > 1 ) {
+        // Instead of taking the last token, add a token for this item if the limits allow.
+        // When the first filter is parallel, several input stage tasks can get here at once, so the
+        // check of the last token is only a hint. Both take_extra_token and the token count are atomic:
+        // a race at worst adds a token that was not needed, without exceeding the maximal number of
+        // tokens, or gives up the extra token and takes the last one as without the limits.
+        bool token_left = my_pipeline.input_tokens.load(std::memory_order_relaxed)==1 && my_pipeline.take_extra_token();
+        if( !token_left )
+            token_left = my_pipeline.input_tokens.fetch_sub(1, std::memory_order_release) > 1;
+        if( token_left && !my_pipeline.stall_input() ) {
             d1::small_object_allocator alloc{};
             r1::spawn( *alloc.new_object<stage_task>(ed, my_pipeline, alloc ), my_pipeline.my_context );
         }
@@ -360,6 +450,7 @@ bool stage_task::execute_filter(d1::execution_data& ed) {
                     reset();
                     return true;
                 } else {
+                    my_bytes = my_pipeline.charge_item(my_object);
                     try_spawn_stage_task(ed);
                 }
             } else {
@@ -378,6 +469,7 @@ bool stage_task::execute_filter(d1::execution_data& ed) {
                 my_pipeline.end_of_input.store(true, std::memory_order_relaxed);
                 return false;
             }
+            my_bytes = my_pipeline.charge_item(my_object);
         }
         my_at_start = false;
     } else {
@@ -397,10 +489,12 @@ bool stage_task::execute_filter(d1::execution_data& ed) {
         }
     } else {
         // Reached end of the pipe.
+        my_pipeline.release_item(my_bytes);
         std::size_t ntokens_avail = my_pipeline.input_tokens.fetch_add(1, std::memory_order_acquire);
 
-        if( ntokens_avail>0  // Only recycle if there is one available token
-                || my_pipeline.end_of_input.load(std::memory_order_relaxed) ) {
+        if( my_pipeline.end_of_input.load(std::memory_order_relaxed)
+                || ( ntokens_avail>0  // Only recycle if there is one available token
+                     && !my_pipeline.try_resume_input() ) ) { // or the input stage stopped because of the byte limit
             return false; // No need to recycle for new input
         }
         ITT_NOTIFY( sync_acquired, &my_pipeline.input_tokens );
@@ -455,6 +549,18 @@ void __TBB_EXPORTED_FUNC parallel_pipeline(d1::task_group_context& cxt, std::siz
     r1::execute_and_wait(st, cxt, pipe.wait_ctx, cxt);
 }
 
+void __TBB_EXPORTED_FUNC parallel_pipeline(d1::task_group_context& cxt, const d1::pipeline_limits& limits, const d1::filter_node& fn) {
+    pipeline pipe(cxt, limits);
+
+    pipe.fill_pipeline(fn);
+
+    d1::small_object_allocator alloc{};
+    stage_task& st = *alloc.new_object<stage_task>(pipe, alloc);
+
+    // Start execution of tasks
+    r1::execute_and_wait(st, cxt, pipe.wait_ctx, cxt);
+}
+
 void __TBB_EXPORTED_FUNC set_end_of_input(d1::base_filter& bf) {
     __TBB_ASSERT(bf.my_input_buffer, nullptr);
     __TBB_ASSERT(bf.object_may_be_null(), nullptr);
@@ -32,6 +32,12 @@ public:
         return my_arena.priority_level();
     }
 
+#if __TBB_PREVIEW_ARENA_WEIGHTS
+    unsigned weight() const {
+        return my_arena.weight();
+    }
+#endif
+
     void set_top_priority(bool b) {
         my_arena.set_top_priority(b);
     }
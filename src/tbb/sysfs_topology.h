@@ -0,0 +1,385 @@
+/*
+    Copyright (c) 2025 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef _TBB_sysfs_topology_H
+#define _TBB_sysfs_topology_H
+
+#include "oneapi/tbb/detail/_config.h"
+#include "oneapi/tbb/detail/_assert.h"
+
+#if __linux__ && __TBB_CPUBIND_PRESENT
+#define __TBB_SYSFS_TOPOLOGY_PRESENT 1
+#else
+#define __TBB_SYSFS_TOPOLOGY_PRESENT 0
+#endif
+
+#if __TBB_SYSFS_TOPOLOGY_PRESENT
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <sched.h>
+
+namespace tbb {
+namespace detail {
+namespace r1 {
+
+//! Set of logical CPUs identified by their OS indexes
+class cpu_mask {
+    std::vector<bool> my_bits;
+public:
+    void set(std::size_t cpu) {
+        if (cpu >= my_bits.size()) {
+            my_bits.resize(cpu + 1, false);
+        }
+        my_bits[cpu] = true;
+    }
+
+    bool test(std::size_t cpu) const {
+        return cpu < my_bits.size() && my_bits[cpu];
+    }
+
+    std::size_t size() const {
+        return my_bits.size();
+    }
+
+    int weight() const {
+        int result = 0;
+        for (bool bit : my_bits) {
+            result += bit ? 1 : 0;
+        }
+        return result;
+    }
+
+    bool empty() const {
+        return weight() == 0;
+    }
+
+    void clear() {
+        my_bits.clear();
+    }
+
+    cpu_mask& operator&=(const cpu_mask& other) {
+        for (std::size_t i = 0; i < my_bits.size(); ++i) {
+            my_bits[i] = my_bits[i] && other.test(i);
+        }
+        return *this;
+    }
+
+    cpu_mask& operator|=(const cpu_mask& other) {
+        for (std::size_t i = 0; i < other.size(); ++i) {
+            if (other.test(i)) {
+                set(i);
+            }
+        }
+        return *this;
+    }
+
+    bool intersects(const cpu_mask& other) const {
+        for (std::size_t i = 0; i < my_bits.size(); ++i) {
+            if (my_bits[i] && other.test(i)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool operator==(const cpu_mask& other) const {
+        std::size_t n = size() > other.size() ? size() : other.size();
+        for (std::size_t i = 0; i < n; ++i) {
+            if (test(i) != other.test(i)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //! Parses the "cpulist" format used by sysfs, e.g. "0-3,8,10-11"
+    static bool parse_list(const char* str, cpu_mask& result) {
+        result.clear();
+        const char* pos = str;
+        while (*pos && *pos != '\n') {
+            char* end = nullptr;
+            long first = std::strtol(pos, &end, 10);
+            if (end == pos || first < 0) {
+                return false;
+            }
+            long last = first;
+            pos = end;
+            if (*pos == '-') {
+                ++pos;
+                last = std::strtol(pos, &end, 10);
+                if (end == pos || last < first) {
+                    return false;
+                }
+                pos = end;
+            }
+            for (long cpu = first; cpu <= last; ++cpu) {
+                result.set(std::size_t(cpu));
+            }
+            if (*pos == ',') {
+                ++pos;
+            } else if (*pos && *pos != '\n') {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //! Reads the affinity mask of the calling thread
+    static bool get_thread_affinity(cpu_mask& result) {
+        // Grow the kernel mask until it is large enough for the machine
+        for (std::size_t num_cpus = 1024; num_cpus <= 256 * 1024; num_cpus *= 2) {
+            cpu_set_t* set = CPU_ALLOC(num_cpus);
+            if (!set) {
+                return false;
+            }
+            std::size_t set_size = CPU_ALLOC_SIZE(num_cpus);
+            CPU_ZERO_S(set_size, set);
+            if (sched_getaffinity(0, set_size, set) == 0) {
+                result.clear();
+                for (std::size_t cpu = 0; cpu < num_cpus; ++cpu) {
+                    if (CPU_ISSET_S(cpu, set_size, set)) {
+                        result.set(cpu);
+                    }
+                }
+                CPU_FREE(set);
+                return true;
+            }
+            CPU_FREE(set);
+        }
+        return false;
+    }
+
+    //! Binds the calling thread to the CPUs of the mask; empty masks are ignored
+    static void set_thread_affinity(const cpu_mask& mask) {
+        if (mask.empty()) {
+            return;
+        }
+        cpu_set_t* set = CPU_ALLOC(mask.size());
+        if (!set) {
+            return;
+        }
+        std::size_t set_size = CPU_ALLOC_SIZE(mask.size());
+        CPU_ZERO_S(set_size, set);
+        for (std::size_t cpu = 0; cpu < mask.size(); ++cpu) {
+            if (mask.test(cpu)) {
+                CPU_SET_S(cpu, set_size, set);
+            }
+        }
+        int status = sched_setaffinity(0, set_size, set);
+        __TBB_ASSERT_EX(status == 0, "sched_setaffinity failed");
+        CPU_FREE(set);
+    }
+};
+
+//! Hardware topology parsed from the Linux sysfs (/sys/devices), used when TBBbind is not available.
+/** Mirrors the information TBBbind obtains from hwloc: NUMA nodes and core types are enumerated
+    by logical indexes in the order of their OS indexes, only entities that intersect the
+    process affinity mask are reported. */
+class sysfs_topology {
+public:
+    enum : int { automatic = -1 };
+
+    explicit sysfs_topology(const char* sysfs_root = "/sys/devices") : my_sysfs_root(sysfs_root) {}
+
+    //! Reads the topology for the given process affinity mask. Returns false if sysfs is not usable.
+    bool parse(const cpu_mask& process_mask) {
+        my_process_mask = process_mask;
+        if (my_process_mask.empty()) {
+            return false;
+        }
+        parse_numa_nodes();
+        parse_core_types();
+        parse_cores();
+        return true;
+    }
+
+    const std::vector<int>& numa_indexes() const { return my_numa_indexes; }
+    const std::vector<int>& core_type_indexes() const { return my_core_type_indexes; }
+    const cpu_mask& process_mask() const { return my_process_mask; }
+
+    //! Computes the set of CPUs matching the arena constraints
+    cpu_mask constraints_mask(int numa_id, int core_type_id, int max_threads_per_core) const {
+        cpu_mask result = my_process_mask;
+        if (numa_id >= 0 && std::size_t(numa_id) < my_numa_masks.size()) {
+            result &= my_numa_masks[numa_id];
+        }
+        if (core_type_id >= 0 && std::size_t(core_type_id) < my_core_type_masks.size()) {
+            result &= my_core_type_masks[core_type_id];
+        }
+        if (max_threads_per_core > 0) {
+            cpu_mask fitted;
+            for (const cpu_mask& core : my_core_masks) {
+                int threads_in_core = 0;
+                for (std::size_t cpu = 0; cpu < core.size(); ++cpu) {
+                    if (core.test(cpu) && result.test(cpu) && threads_in_core++ < max_threads_per_core) {
+                        fitted.set(cpu);
+                    }
+                }
+            }
+            result = fitted;
+        }
+        return result;
+    }
+
+    int default_concurrency(int numa_id, int core_type_id, int max_threads_per_core) const {
+        return constraints_mask(numa_id, core_type_id, max_threads_per_core).weight();
+    }
+
+private:
+    static void close_file(std::FILE* file) { std::fclose(file); }
+    using unique_file_t = std::unique_ptr<std::FILE, decltype(&close_file)>;
+
+    static constexpr std::size_t path_size = 256;
+    static constexpr std::size_t line_size = 4096;
+
+    bool read_cpu_list(const char* relative_path, cpu_mask& result) const {
+        char path[path_size];
+        int length = std::snprintf(path, path_size, "%s/%s", my_sysfs_root, relative_path);
+        if (length < 0 || std::size_t(length) >= path_size) {
+            return false;
+        }
+        unique_file_t file(std::fopen(path, "r"), &close_file);
+        if (!file) {
+            return false;
+        }
+        char line[line_size];
+        if (!std::fgets(line, line_size, file.get())) {
+            return false;
+        }
+        return cpu_mask::parse_list(line, result);
+    }
+
+    void parse_numa_nodes() {
+        cpu_mask online_nodes;
+        if (read_cpu_list("system/node/online", online_nodes)) {
+            int logical_index = 0;
+            char relative_path[path_size];
+            for (std::size_t node = 0; node < online_nodes.size(); ++node) {
+                if (!online_nodes.test(node)) {
+                    continue;
+                }
+                cpu_mask node_mask;
+                std::snprintf(relative_path, path_size, "system/node/node%d/cpulist", int(node));
+                if (read_cpu_list(relative_path, node_mask)) {
+                    node_mask &= my_process_mask;
+                    if (!node_mask.empty()) {
+                        my_numa_masks.resize(logical_index + 1);
+                        my_numa_masks[logical_index] = node_mask;
+                        my_numa_indexes.push_back(logical_index);
+                    }
+                }
+                ++logical_index;
+            }
+        }
+        if (my_numa_indexes.empty()) {
+            // Kernels without NUMA support expose no nodes; treat the process mask as a single node
+            my_numa_masks.assign(1, my_process_mask);
+            my_numa_indexes.push_back(0);
+        }
+    }
+
+    void parse_core_types() {
+        // Hybrid CPUs expose a PMU per core type; the less efficient type goes first like in hwloc
+        static const char* core_type_paths[] = { "cpu_atom/cpus", "cpu_core/cpus" };
+        for (const char* path : core_type_paths) {
+            cpu_mask type_mask;
+            if (read_cpu_list(path, type_mask)) {
+                type_mask &= my_process_mask;
+                if (!type_mask.empty()) {
+                    my_core_type_masks.push_back(type_mask);
+                }
+            }
+        }
+        if (my_core_type_masks.size() > 1) {
+            for (std::size_t i = 0; i < my_core_type_masks.size(); ++i) {
+                my_core_type_indexes.push_back(int(i));
+            }
+        } else {
+            my_core_type_masks.clear();
+            my_core_type_indexes.push_back(automatic);
+        }
+    }
+
+    void parse_cores() {
+        cpu_mask assigned;
+        char relative_path[path_size];
+        for (std::size_t cpu = 0; cpu < my_process_mask.size(); ++cpu) {
+            if (!my_process_mask.test(cpu) || assigned.test(cpu)) {
+                continue;
+            }
+            cpu_mask core_mask;
+            std::snprintf(relative_path, path_size, "system/cpu/cpu%d/topology/thread_siblings_list", int(cpu));
+            if (!read_cpu_list(relative_path, core_mask) || !core_mask.test(cpu)) {
+                // Unknown SMT layout; consider the CPU a core of its own
+                core_mask.clear();
+                core_mask.set(cpu);
+            }
+            core_mask &= my_process_mask;
+            assigned |= core_mask;
+            my_core_masks.push_back(core_mask);
+        }
+    }
+
+    const char* my_sysfs_root;
+    cpu_mask my_process_mask;
+
+    std::vector<int> my_numa_indexes;
+    std::vector<cpu_mask> my_numa_masks;
+
+    std::vector<int> my_core_type_indexes;
+    std::vector<cpu_mask> my_core_type_masks;
+
+    std::vector<cpu_mask> my_core_masks;
+};
+
+//! Per-arena binding state, the counterpart of the TBBbind binding_handler
+class sysfs_binding_handler {
+    const cpu_mask my_handler_mask;
+    // Thread masks saved on scheduler entry to be restored on exit
+    std::vector<cpu_mask> my_affinity_backup;
+public:
+    sysfs_binding_handler(const sysfs_topology& topology, std::size_t num_slots,
+                          int numa_id, int core_type_id, int max_threads_per_core)
+        : my_handler_mask(topology.constraints_mask(numa_id, core_type_id, max_threads_per_core))
+        , my_affinity_backup(num_slots)
+    {}
+
+    void apply_affinity(std::size_t slot_num) {
+        __TBB_ASSERT(slot_num < my_affinity_backup.size(),
+            "The slot number is greater than the number of slots in the arena");
+        cpu_mask::get_thread_affinity(my_affinity_backup[slot_num]);
+        cpu_mask::set_thread_affinity(my_handler_mask);
+    }
+
+    void restore_affinity(std::size_t slot_num) {
+        __TBB_ASSERT(slot_num < my_affinity_backup.size(),
+            "The slot number is greater than the number of slots in the arena");
+        cpu_mask::set_thread_affinity(my_affinity_backup[slot_num]);
+    }
+};
+
+} // namespace r1
+} // namespace detail
+} // namespace tbb
+
+#endif /* __TBB_SYSFS_TOPOLOGY_PRESENT */
+
+#endif /* _TBB_sysfs_topology_H */
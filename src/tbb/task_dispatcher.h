@@ -352,6 +352,12 @@ d1::task* task_dispatcher::local_wait_for_all(d1::task* t, Waiter& waiter ) {
                     // Reset task owner id for bypassed task
                     ed.original_slot = m_thread_data->my_arena_index;
                     m_innermost_running_task = prev_innermost_running_task;
+                    if (t != nullptr && waiter.is_preemption_requested()) {
+                        // The worker is recalled to a higher priority arena. Leave the bypassed
+                        // task to the remaining threads instead of following the whole chain.
+                        r1::spawn(*t, *ed.context);
+                        t = nullptr;
+                    }
                     t = get_critical_task(t, ed, isolation, critical_allowed);
                 }
                 __TBB_ASSERT(m_thread_data && governor::is_thread_data_set(m_thread_data), nullptr);
@@ -57,7 +57,10 @@ protected:
 
 class outermost_worker_waiter : public waiter_base {
 public:
-    using waiter_base::waiter_base;
+    outermost_worker_waiter(arena& a, int yields_multiplier = 1)
+        : waiter_base(a, yields_multiplier)
+        , my_allotment_epoch(a.my_allotment_epoch.load(std::memory_order_relaxed))
+    {}
 
     bool continue_execution(arena_slot& slot, d1::task*& t) {
         __TBB_ASSERT(t == nullptr, nullptr);
@@ -105,9 +108,23 @@ public:
         return false;
     }
 
+    //! Checks at a task boundary whether the worker is recalled in favor of a higher priority arena.
+    /** Only a change of the allotment epoch triggers the check, so the common path is a single load. **/
+    bool is_preemption_requested() {
+        unsigned epoch = my_arena.my_allotment_epoch.load(std::memory_order_relaxed);
+        if (epoch == my_allotment_epoch) {
+            return false;
+        }
+        my_allotment_epoch = epoch;
+        return !my_arena.is_top_priority() && my_arena.is_recall_requested();
+    }
+
 private:
     using base_type = waiter_base;
 
+    //! The last observed value of arena::my_allotment_epoch.
+    unsigned my_allotment_epoch;
+
     bool is_delayed_leave_enabled() {
 #if __TBB_PREVIEW_PARALLEL_PHASE
        return my_arena.my_thread_leave.is_retention_allowed();
@@ -184,6 +201,10 @@ public:
         return false;
     }
 
+    static bool is_preemption_requested() {
+        return false;
+    }
+
 private:
     d1::wait_context& my_wait_ctx;
 };
@@ -219,6 +240,10 @@ public:
     static bool postpone_execution(d1::task& t) {
         return task_accessor::is_resume_task(t);
     }
+
+    static bool is_preemption_requested() {
+        return false;
+    }
 };
 
 #endif // __TBB_RESUMABLE_TASKS
@@ -0,0 +1,266 @@
+/*
+    Copyright (c) 2025 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#define TBB_PREVIEW_ALGORITHMS 1
+
+#include "common/test.h"
+#include "common/utils.h"
+
+#include "tbb/algorithms.h"
+#include "tbb/global_control.h"
+#include "tbb/task_arena.h"
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+//! \file test_algorithms.cpp
+//! \brief Test for [preview] functionality of the tbb::algorithms library
+
+namespace algorithms = tbb::algorithms;
+
+static const std::size_t sizes[] = { 0, 1, 17, 3000, 100000 };
+
+//! Values with many duplicates so that equivalent elements meet across subrange boundaries
+std::vector<int> make_input( std::size_t n, int max_value, unsigned seed ) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, max_value);
+    std::vector<int> v(n);
+    for (auto& x : v) {
+        x = dist(gen);
+    }
+    return v;
+}
+
+//! Pair ordered by key only, used to check stability
+struct keyed {
+    int key;
+    std::size_t index;
+
+    friend bool operator==( const keyed& lhs, const keyed& rhs ) {
+        return lhs.key == rhs.key && lhs.index == rhs.index;
+    }
+};
+
+std::vector<keyed> make_keyed( std::size_t n, int max_key, unsigned seed ) {
+    std::vector<int> keys = make_input(n, max_key, seed);
+    std::vector<keyed> v(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        v[i] = keyed{keys[i], i};
+    }
+    return v;
+}
+
+auto by_key = []( const keyed& lhs, const keyed& rhs ) { return lhs.key < rhs.key; };
+
+void test_transform() {
+    for (std::size_t n : sizes) {
+        std::vector<int> in = make_input(n, 1000, 1);
+        std::vector<long> out(n), expected(n);
+        auto op = []( int x ) { return long(x) * x; };
+        std::transform(in.begin(), in.end(), expected.begin(), op);
+        REQUIRE(algorithms::transform(in.begin(), in.end(), out.begin(), op) == out.end());
+        REQUIRE(out == expected);
+
+        std::vector<int> in2 = make_input(n, 1000, 2);
+        auto binary_op = []( int x, int y ) { return long(x) - y; };
+        std::transform(in.begin(), in.end(), in2.begin(), expected.begin(), binary_op);
+        algorithms::transform(in.begin(), in.end(), in2.begin(), out.begin(), binary_op);
+        REQUIRE(out == expected);
+
+        std::fill(out.begin(), out.end(), 0);
+        algorithms::transform(in, out.begin(), [](int x) { return long(x) + 1; });
+        REQUIRE(std::equal(in.begin(), in.end(), out.begin(), []( int x, long y ) { return y == x + 1; }));
+    }
+}
+
+void test_compaction() {
+    auto is_even = []( const keyed& x ) { return x.key % 2 == 0; };
+    auto key_eq = []( const keyed& lhs, const keyed& rhs ) { return lhs.key == rhs.key; };
+    for (std::size_t n : sizes) {
+        std::vector<keyed> in = make_keyed(n, 10, 3);
+
+        std::vector<keyed> out(n), expected(n);
+        auto expected_end = std::copy_if(in.begin(), in.end(), expected.begin(), is_even);
+        auto out_end = algorithms::copy_if(in.begin(), in.end(), out.begin(), is_even);
+        REQUIRE(out_end - out.begin() == expected_end - expected.begin());
+        REQUIRE(std::equal(out.begin(), out_end, expected.begin()));
+
+        std::vector<keyed> out_false(n), expected_false(n);
+        auto expected_ends = std::partition_copy(in.begin(), in.end(), expected.begin(), expected_false.begin(), is_even);
+        auto out_ends = algorithms::partition_copy(in, out.begin(), out_false.begin(), is_even);
+        REQUIRE(out_ends.first - out.begin() == expected_ends.first - expected.begin());
+        REQUIRE(out_ends.second - out_false.begin() == expected_ends.second - expected_false.begin());
+        REQUIRE(std::equal(out.begin(), out_ends.first, expected.begin()));
+        REQUIRE(std::equal(out_false.begin(), out_ends.second, expected_false.begin()));
+
+        expected_end = std::unique_copy(in.begin(), in.end(), expected.begin(), key_eq);
+        out_end = algorithms::unique_copy(in.begin(), in.end(), out.begin(), key_eq);
+        REQUIRE(out_end - out.begin() == expected_end - expected.begin());
+        REQUIRE(std::equal(out.begin(), out_end, expected.begin()));
+
+        std::vector<keyed> partitioned = in;
+        expected = in;
+        auto expected_mid = std::stable_partition(expected.begin(), expected.end(), is_even);
+        auto mid = algorithms::stable_partition(partitioned, is_even);
+        REQUIRE(mid - partitioned.begin() == expected_mid - expected.begin());
+        REQUIRE(partitioned == expected);
+
+        std::vector<keyed> uniq = in;
+        expected = in;
+        expected_end = std::unique(expected.begin(), expected.end(), key_eq);
+        auto uniq_end = algorithms::unique(uniq.begin(), uniq.end(), key_eq);
+        REQUIRE(uniq_end - uniq.begin() == expected_end - expected.begin());
+        REQUIRE(std::equal(uniq.begin(), uniq_end, expected.begin()));
+    }
+}
+
+void test_merge() {
+    for (std::size_t n : sizes) {
+        for (std::size_t m : { std::size_t(0), n / 3, n }) {
+            std::vector<keyed> in1 = make_keyed(n, 50, 4);
+            std::vector<keyed> in2 = make_keyed(m, 50, 5);
+            for (auto& x : in2) {
+                x.index += n;
+            }
+            std::stable_sort(in1.begin(), in1.end(), by_key);
+            std::stable_sort(in2.begin(), in2.end(), by_key);
+            std::vector<keyed> out(n + m), expected(n + m);
+            std::merge(in1.begin(), in1.end(), in2.begin(), in2.end(), expected.begin(), by_key);
+            REQUIRE(algorithms::merge(in1, in2, out.begin(), by_key) == out.end());
+            REQUIRE(out == expected);
+        }
+    }
+}
+
+template <typename ParallelOp, typename SerialOp>
+void check_set_operation( const std::vector<int>& in1, const std::vector<int>& in2, ParallelOp parallel_op,
+                          SerialOp serial_op )
+{
+    std::vector<int> out(in1.size() + in2.size()), expected(in1.size() + in2.size());
+    auto expected_end = serial_op(in1.begin(), in1.end(), in2.begin(), in2.end(), expected.begin());
+    auto out_end = parallel_op(in1.begin(), in1.end(), in2.begin(), in2.end(), out.begin());
+    REQUIRE(out_end - out.begin() == expected_end - expected.begin());
+    REQUIRE(std::equal(out.begin(), out_end, expected.begin()));
+}
+
+void test_set_operations() {
+    using it = std::vector<int>::iterator;
+    using const_it = std::vector<int>::const_iterator;
+    for (std::size_t n : sizes) {
+        for (int max_value : { 20, 100000 }) {
+            std::vector<int> in1 = make_input(n, max_value, 6);
+            std::vector<int> in2 = make_input(n / 2 + 1, max_value, 7);
+            std::sort(in1.begin(), in1.end());
+            std::sort(in2.begin(), in2.end());
+
+            check_set_operation(in1, in2, algorithms::set_union<const_it, const_it, it>,
+                                std::set_union<const_it, const_it, it>);
+            check_set_operation(in1, in2, algorithms::set_intersection<const_it, const_it, it>,
+                                std::set_intersection<const_it, const_it, it>);
+            check_set_operation(in1, in2, algorithms::set_difference<const_it, const_it, it>,
+                                std::set_difference<const_it, const_it, it>);
+            check_set_operation(in1, in2, algorithms::set_symmetric_difference<const_it, const_it, it>,
+                                std::set_symmetric_difference<const_it, const_it, it>);
+        }
+    }
+}
+
+void test_selection() {
+    for (std::size_t n : sizes) {
+        if (n == 0) {
+            continue;
+        }
+        for (int max_value : { 3, 1000000 }) {
+            std::vector<int> in = make_input(n, max_value, 8);
+            std::vector<int> sorted = in;
+            std::sort(sorted.begin(), sorted.end());
+
+            for (std::size_t k : { std::size_t(0), n / 2, n - 1 }) {
+                std::vector<int> v = in;
+                algorithms::nth_element(v.begin(), v.begin() + k, v.end());
+                REQUIRE(v[k] == sorted[k]);
+                REQUIRE(std::all_of(v.begin(), v.begin() + k, [&]( int x ) { return x <= v[k]; }));
+                REQUIRE(std::all_of(v.begin() + k, v.end(), [&]( int x ) { return x >= v[k]; }));
+            }
+
+            std::vector<int> top(10, -1);
+            auto top_end = algorithms::top_k(in, 10, top.begin());
+            std::size_t expected_size = std::min(n, std::size_t(10));
+            REQUIRE(std::size_t(top_end - top.begin()) == expected_size);
+            REQUIRE(std::equal(top.begin(), top_end, sorted.begin()));
+
+            top_end = algorithms::top_k(in.begin(), in.end(), 10, top.begin(), std::greater<int>());
+            REQUIRE(std::equal(top.begin(), top_end, sorted.rbegin()));
+        }
+    }
+}
+
+void test_histogram() {
+    for (std::size_t n : sizes) {
+        std::vector<int> in = make_input(n, 99, 9);
+        std::vector<std::size_t> counts(10, 42), expected(10, 0);
+        // Values above 89 fall outside of the bins and are ignored
+        auto bin = []( int x ) { return x / 9; };
+        for (int x : in) {
+            if (bin(x) < 10) {
+                ++expected[bin(x)];
+            }
+        }
+        algorithms::histogram(in, counts, bin);
+        REQUIRE(counts == expected);
+    }
+}
+
+void test_all() {
+    test_transform();
+    test_compaction();
+    test_merge();
+    test_set_operations();
+    test_selection();
+    test_histogram();
+}
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("tbb::algorithms match the serial standard algorithms") {
+    test_all();
+}
+
+//! \brief \ref requirement
+TEST_CASE("tbb::algorithms in a multi-threaded arena") {
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, 4);
+    tbb::task_arena arena(4);
+    arena.execute(test_all);
+}
+
+//! \brief \ref interface
+TEST_CASE("tbb::algorithms accept non-vector ranges") {
+    int data[] = { 5, 3, 3, 1, 4, 1, 5, 9, 2, 6 };
+    int out[10] = {};
+    std::string text = "aabbbcdd";
+    std::string letters;
+    letters.resize(text.size());
+
+    auto end = algorithms::copy_if(data, out, []( int x ) { return x > 3; });
+    REQUIRE(end - out == 5);
+    REQUIRE(out[0] == 5);
+    REQUIRE(out[4] == 6);
+
+    auto letters_end = algorithms::unique_copy(text, letters.begin());
+    REQUIRE(std::string(letters.begin(), letters_end) == "abcd");
+}
@@ -14,6 +14,8 @@
     limitations under the License.
 */
 
+#define TBB_PREVIEW_TASK_GROUP_EXTENSIONS 1
+
 #include "common/test.h"
 
 #include "tbb/task_group.h"
@@ -27,6 +29,8 @@
 #include <cstddef>
 #include <algorithm>
 #include <numeric>
+#include <chrono>
+#include <thread>
 
 //! \file test_arena_priorities.cpp
 //! \brief Test for [scheduler.task_arena] specification
@@ -359,6 +363,71 @@ void test() {
 
 } // namespace HighPriorityArenasTakeExecutionPrecedence
 
+namespace WorkersLeaveBypassChainsForHigherPriority {
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr int max_chain_length = 20000;
+
+struct chain_link {
+    tbb::task_group& tg;
+    std::atomic<bool>& stop;
+    std::atomic<int>& executed;
+
+    tbb::task_handle operator()() const {
+        auto start = clock_type::now();
+        while (clock_type::now() - start < std::chrono::microseconds(100)) {
+            utils::yield();
+        }
+        int n = ++executed;
+        if (stop.load() || n >= max_chain_length) {
+            return tg.defer([] {});
+        }
+        // The next link is bypassed, so the worker never returns to the outermost dispatch loop
+        return tg.defer(*this);
+    }
+};
+
+void test() {
+    tbb::global_control control(tbb::global_control::max_allowed_parallelism, 2);
+
+    tbb::task_arena normal_arena(1, 0, tbb::task_arena::priority::normal);
+    tbb::task_arena high_arena(1, 0, tbb::task_arena::priority::high);
+
+    std::atomic<bool> stop{false};
+    std::atomic<int> executed{0};
+    tbb::task_group tg;
+    normal_arena.enqueue(tg.defer(chain_link{tg, stop, executed}));
+
+    auto wait_for = [](const std::atomic<bool>& flag, std::chrono::seconds timeout) {
+        auto start = clock_type::now();
+        while (!flag.load() && clock_type::now() - start < timeout) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    };
+
+    // Wait until a worker is inside the chain
+    while (executed.load() == 0) {
+        std::this_thread::yield();
+    }
+
+    std::atomic<bool> high_priority_done{false};
+    int executed_before_high_priority = 0;
+    high_arena.enqueue([&] {
+        executed_before_high_priority = executed.load();
+        high_priority_done = true;
+    });
+    wait_for(high_priority_done, std::chrono::seconds(60));
+    REQUIRE_MESSAGE(high_priority_done.load(), "The high priority work was not executed");
+    CHECK_MESSAGE(executed_before_high_priority < max_chain_length,
+                  "The worker did not leave the bypass chain of the lower priority arena");
+
+    stop = true;
+    normal_arena.execute([&] { tg.wait(); });
+}
+
+} // namespace WorkersLeaveBypassChainsForHigherPriority
+
 
 // TODO: nested arena case
 //! Test for setting a priority to arena
@@ -366,3 +435,9 @@ void test() {
 TEST_CASE("Arena priorities") {
     HighPriorityArenasTakeExecutionPrecedence::test();
 }
+
+//! Test that a worker leaves a lower priority arena between bypassed tasks
+//! \brief \ref requirement
+TEST_CASE("Workers migrate to higher priority arena at task boundaries") {
+    WorkersLeaveBypassChainsForHigherPriority::test();
+}
@@ -0,0 +1,110 @@
+/*
+    Copyright (c) 2025 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+//! \file test_arena_warm_up.cpp
+//! \brief Test for [preview] functionality
+
+#define TBB_PREVIEW_ARENA_WARM_UP 1
+
+#include "common/test.h"
+#include "common/utils.h"
+#include "common/utils_concurrency_limit.h"
+
+#include "tbb/task_arena.h"
+#include "tbb/task_scheduler_observer.h"
+#include "tbb/global_control.h"
+
+#include <atomic>
+
+class worker_entry_counter : public tbb::task_scheduler_observer {
+    std::atomic<int> my_worker_entries{0};
+public:
+    worker_entry_counter(tbb::task_arena& ta) : tbb::task_scheduler_observer(ta) {
+        observe(true);
+    }
+    ~worker_entry_counter() override {
+        observe(false);
+    }
+    void on_scheduler_entry(bool is_worker) override {
+        if (is_worker) {
+            ++my_worker_entries;
+        }
+    }
+    int worker_entries() const {
+        return my_worker_entries.load();
+    }
+};
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("warm_up brings workers into the arena") {
+    const int num_threads = 4;
+    // Allow workers even on machines with less cores
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, num_threads);
+    tbb::task_arena ta(num_threads);
+    ta.initialize();
+    worker_entry_counter counter(ta);
+
+    int num_workers = ta.warm_up();
+    CHECK(num_workers == num_threads - 1);
+    // Every worker that met the rendezvous has entered the arena
+    CHECK(counter.worker_entries() >= num_workers);
+    CHECK(ta.is_active());
+}
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("warm_up respects the requested number of workers") {
+    const int num_threads = 4;
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, num_threads);
+    tbb::task_arena ta(num_threads);
+    ta.initialize();
+    worker_entry_counter counter(ta);
+
+    CHECK(ta.warm_up(0) == 0);
+    CHECK(ta.is_active());
+    CHECK(counter.worker_entries() == 0);
+    CHECK(ta.warm_up(1) == 1);
+    CHECK(counter.worker_entries() >= 1);
+    // The request is clamped by the number of slots available to workers
+    CHECK(ta.warm_up(100) == num_threads - 1);
+    CHECK(counter.worker_entries() >= num_threads - 1);
+
+    tbb::task_arena reserved_ta(num_threads, num_threads);
+    CHECK(reserved_ta.warm_up() == 0);
+}
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("this_task_arena::warm_up") {
+    const int num_threads = 3;
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, num_threads);
+    tbb::task_arena ta(num_threads);
+    ta.initialize();
+    worker_entry_counter counter(ta);
+    int num_workers = ta.execute([] {
+        return tbb::this_task_arena::warm_up();
+    });
+    CHECK(num_workers == num_threads - 1);
+    CHECK(counter.worker_entries() >= num_workers);
+}
+
+//! \brief \ref error_guessing
+TEST_CASE("warm_up completes when workers are not available") {
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, 1);
+    tbb::task_arena ta(4);
+    CHECK(ta.warm_up() == 0);
+    // The arena is still usable after the warm-up timed out
+    int result = ta.execute([] { return 42; });
+    CHECK(result == 42);
+}
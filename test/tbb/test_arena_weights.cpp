@@ -0,0 +1,186 @@
+/*
+    Copyright (c) 2025 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+//! \file test_arena_weights.cpp
+//! \brief Test for [preview] functionality
+
+#define TBB_PREVIEW_ARENA_WEIGHTS 1
+
+#include "common/test.h"
+#include "common/utils.h"
+
+#include "tbb/task_arena.h"
+#include "tbb/task_scheduler_observer.h"
+#include "tbb/global_control.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+class active_workers_counter : public tbb::task_scheduler_observer {
+    std::atomic<int> my_active_workers{0};
+public:
+    active_workers_counter(tbb::task_arena& ta) : tbb::task_scheduler_observer(ta) {
+        observe(true);
+    }
+    ~active_workers_counter() override {
+        observe(false);
+    }
+    void on_scheduler_entry(bool is_worker) override {
+        if (is_worker) {
+            ++my_active_workers;
+        }
+    }
+    void on_scheduler_exit(bool is_worker) override {
+        if (is_worker) {
+            --my_active_workers;
+        }
+    }
+    int active_workers() const {
+        return my_active_workers.load();
+    }
+};
+
+//! Keeps the arena busy with short tasks so that workers can be recalled at task boundaries
+class arena_load {
+    tbb::task_arena& my_arena;
+    std::atomic<bool> my_stop{false};
+    std::atomic<int> my_in_flight{0};
+
+    void submit() {
+        ++my_in_flight;
+        my_arena.enqueue([this] {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            if (!my_stop.load(std::memory_order_relaxed)) {
+                submit();
+            }
+            --my_in_flight;
+        });
+    }
+public:
+    arena_load(tbb::task_arena& ta, int num_tasks) : my_arena(ta) {
+        for (int i = 0; i < num_tasks; ++i) {
+            submit();
+        }
+    }
+    ~arena_load() {
+        my_stop = true;
+        while (my_in_flight.load() != 0) {
+            std::this_thread::yield();
+        }
+    }
+};
+
+//! Waits until the predicate holds for a while, returns false on timeout
+template <typename Predicate>
+bool wait_for_stable(Predicate pred) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    int stable_checks = 0;
+    while (std::chrono::steady_clock::now() < deadline) {
+        stable_checks = pred() ? stable_checks + 1 : 0;
+        if (stable_checks == 10) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return false;
+}
+
+//! \brief \ref interface
+TEST_CASE("Weight setting") {
+    tbb::task_arena a;
+    CHECK(a.weight() == 1);
+    a.set_weight(5);
+    CHECK(a.weight() == 5);
+
+    tbb::task_arena copy(a);
+    CHECK(copy.weight() == 5);
+
+    a.initialize();
+    a.execute([] {
+        tbb::task_arena attached(tbb::task_arena::attach{});
+        CHECK(attached.weight() == 5);
+    });
+
+    tbb::task_arena max_weighted;
+    max_weighted.set_weight(tbb::task_arena::max_weight);
+    CHECK(max_weighted.weight() == tbb::task_arena::max_weight);
+}
+
+//! \brief \ref requirement
+TEST_CASE("Workers are shared in proportion to the arena weights") {
+    const int num_workers = 8;
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, num_workers + 1);
+
+    tbb::task_arena heavy(num_workers + 1), light(num_workers + 1);
+    heavy.set_weight(3);
+    light.set_weight(1);
+    heavy.initialize();
+    light.initialize();
+    active_workers_counter heavy_counter(heavy), light_counter(light);
+
+    {
+        arena_load light_load(light, 2 * num_workers);
+        arena_load heavy_load(heavy, 2 * num_workers);
+        bool converged = wait_for_stable([&] {
+            return heavy_counter.active_workers() == 6 && light_counter.active_workers() == 2;
+        });
+        CHECK_MESSAGE(converged, "heavy: " << heavy_counter.active_workers() << ", light: " << light_counter.active_workers());
+    }
+}
+
+//! \brief \ref requirement
+TEST_CASE("Idle share is borrowed by other arenas") {
+    const int num_workers = 4;
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, num_workers + 1);
+
+    tbb::task_arena heavy(num_workers + 1), light(num_workers + 1);
+    heavy.set_weight(3);
+    light.set_weight(1);
+    heavy.initialize();
+    light.initialize();
+    active_workers_counter light_counter(light);
+
+    // The heavy arena has no work, so the light one gets all the workers
+    arena_load light_load(light, 2 * num_workers);
+    bool converged = wait_for_stable([&] {
+        return light_counter.active_workers() == num_workers;
+    });
+    CHECK_MESSAGE(converged, "light: " << light_counter.active_workers());
+}
+
+//! \brief \ref requirement
+TEST_CASE("Arena demand caps the weighted share") {
+    const int num_workers = 6;
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, num_workers + 1);
+
+    // The heavy arena cannot take more than 2 workers, the rest goes to the light one
+    tbb::task_arena heavy(3), light(num_workers + 1);
+    heavy.set_weight(10);
+    light.set_weight(1);
+    heavy.initialize();
+    light.initialize();
+    active_workers_counter heavy_counter(heavy), light_counter(light);
+
+    {
+        arena_load heavy_load(heavy, 2 * num_workers);
+        arena_load light_load(light, 2 * num_workers);
+        bool converged = wait_for_stable([&] {
+            return heavy_counter.active_workers() == 2 && light_counter.active_workers() == 4;
+        });
+        CHECK_MESSAGE(converged, "heavy: " << heavy_counter.active_workers() << ", light: " << light_counter.active_workers());
+    }
+}
@@ -14,6 +14,8 @@
     limitations under the License.
 */
 
+#define TBB_PREVIEW_SPACE_FILLING_RANGE 1
+
 #include "common/test.h"
 #include "common/utils.h"
 #include "common/utils_report.h"
@@ -25,13 +27,20 @@
 #include "tbb/blocked_range2d.h"
 #include "tbb/blocked_range3d.h"
 #include "tbb/blocked_nd_range.h"
+#include "tbb/space_filling_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/global_control.h"
+#include "tbb/task_arena.h"
 
 //! \file test_blocked_range.cpp
 //! \brief Test for [algorithms.blocked_range algorithms.blocked_range2d algorithms.blocked_range3d algorithms.blocked_nd_range] specification
+//! and [preview] space_filling_range
 
 #include <utility> //for std::pair
 #include <functional>
 #include <vector>
+#include <atomic>
+#include <cstdlib>
 
 //! Testing blocked_range with range based for
 //! \brief \ref interface
@@ -337,3 +346,186 @@ TEST_CASE("blocked_nd_range deduction guides") {
     test_deduction_guides<fancy_value>();
 }
 #endif // __TBB_CPP17_DEDUCTION_GUIDES_PRESENT && __TBB_PREVIEW_BLOCKED_ND_RANGE_DEDUCTION_GUIDES
+
+template <typename F>
+void for_each_point( const tbb::blocked_range2d<int>& r, const tbb::blocked_range2d<int>& whole, F f ) {
+    for (int i = r.rows().begin(); i != r.rows().end(); ++i) {
+        for (int j = r.cols().begin(); j != r.cols().end(); ++j) {
+            f(std::size_t(i) * whole.cols().end() + j);
+        }
+    }
+}
+
+template <typename F>
+void for_each_point( const tbb::blocked_range3d<int>& r, const tbb::blocked_range3d<int>& whole, F f ) {
+    for (int i = r.pages().begin(); i != r.pages().end(); ++i) {
+        for (int j = r.rows().begin(); j != r.rows().end(); ++j) {
+            for (int k = r.cols().begin(); k != r.cols().end(); ++k) {
+                f((std::size_t(i) * whole.rows().end() + j) * whole.cols().end() + k);
+            }
+        }
+    }
+}
+
+template <typename F>
+void for_each_point( const tbb::blocked_nd_range<int, 4>& r, const tbb::blocked_nd_range<int, 4>& whole, F f ) {
+    for (int i0 = r.dim(0).begin(); i0 != r.dim(0).end(); ++i0) {
+        for (int i1 = r.dim(1).begin(); i1 != r.dim(1).end(); ++i1) {
+            for (int i2 = r.dim(2).begin(); i2 != r.dim(2).end(); ++i2) {
+                for (int i3 = r.dim(3).begin(); i3 != r.dim(3).end(); ++i3) {
+                    std::size_t index = i0;
+                    index = index * whole.dim(1).end() + i1;
+                    index = index * whole.dim(2).end() + i2;
+                    f(index * whole.dim(3).end() + i3);
+                }
+            }
+        }
+    }
+}
+
+//! Checks that the subranges of a space-filling range cover every point of the range exactly once
+template <typename Range, typename Partitioner>
+void check_space_filling_coverage( const Range& range, std::size_t volume, Partitioner&& partitioner ) {
+    std::vector<std::atomic<int>> visits(volume);
+    for (auto& v : visits) {
+        v.store(0, std::memory_order_relaxed);
+    }
+    auto visit = [&]( std::size_t index ) { visits[index].fetch_add(1, std::memory_order_relaxed); };
+    auto body = [&]( const Range& r ) {
+        for_each_point(r, range, visit);
+    };
+    tbb::parallel_for(tbb::hilbert_order(range), body, partitioner);
+    tbb::parallel_for(tbb::morton_order(range), body, partitioner);
+    for (auto& v : visits) {
+        REQUIRE(v.load(std::memory_order_relaxed) == 2);
+    }
+}
+
+template <typename Partitioner>
+void check_space_filling_coverage( Partitioner&& partitioner ) {
+    check_space_filling_coverage(tbb::blocked_range2d<int>(0, 97, 3, 0, 130, 5), 97 * 130, partitioner);
+    check_space_filling_coverage(tbb::blocked_range3d<int>(0, 9, 1, 0, 31, 2, 0, 17, 4), 9 * 31 * 17, partitioner);
+    int sizes[] = { 7, 6, 11, 5 };
+    check_space_filling_coverage(tbb::blocked_nd_range<int, 4>(sizes, 2), 7 * 6 * 11 * 5, partitioner);
+}
+
+void check_space_filling_coverage() {
+    check_space_filling_coverage(tbb::simple_partitioner());
+    check_space_filling_coverage(tbb::auto_partitioner());
+    check_space_filling_coverage(tbb::static_partitioner());
+    tbb::affinity_partitioner ap;
+    check_space_filling_coverage(ap);
+}
+
+//! Returns the number of consecutive leaves of a serial traversal that do not share a face
+template <typename Range>
+std::size_t count_space_filling_jumps( const Range& range ) {
+    std::vector<tbb::blocked_range2d<int>> order;
+    tbb::task_arena arena(1);
+    arena.execute([&] {
+        tbb::parallel_for(range, [&]( const tbb::blocked_range2d<int>& r ) {
+            order.push_back(r);
+        }, tbb::simple_partitioner());
+    });
+    auto touch = []( const tbb::blocked_range<int>& a, const tbb::blocked_range<int>& b ) {
+        return a.end() == b.begin() || b.end() == a.begin();
+    };
+    auto overlap = []( const tbb::blocked_range<int>& a, const tbb::blocked_range<int>& b ) {
+        return a.begin() < b.end() && b.begin() < a.end();
+    };
+    std::size_t jumps = 0;
+    for (std::size_t i = 1; i < order.size(); ++i) {
+        const auto& a = order[i - 1];
+        const auto& b = order[i];
+        if (!(touch(a.rows(), b.rows()) && overlap(a.cols(), b.cols())) &&
+            !(touch(a.cols(), b.cols()) && overlap(a.rows(), b.rows()))) {
+            ++jumps;
+        }
+    }
+    return jumps;
+}
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("space_filling_range covers the range exactly once") {
+    check_space_filling_coverage();
+}
+
+//! \brief \ref requirement
+TEST_CASE("space_filling_range in a multi-threaded arena") {
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, 4);
+    tbb::task_arena arena(4);
+    arena.execute([] { check_space_filling_coverage(); });
+}
+
+//! \brief \ref requirement
+TEST_CASE("Hilbert order keeps consecutive subranges adjacent") {
+    for (int size : { 8, 64 }) {
+        tbb::blocked_range2d<int> range(0, size, 1, 0, size, 1);
+        CHECK(count_space_filling_jumps(tbb::hilbert_order(range)) == 0);
+        CHECK(count_space_filling_jumps(tbb::morton_order(range)) > 0);
+    }
+    tbb::blocked_range2d<int> range(0, 64, 1, 0, 16, 1);
+    CHECK(count_space_filling_jumps(tbb::hilbert_order(range)) == 0);
+    // Uneven ranges are mostly continuous
+    tbb::blocked_range2d<int> uneven(0, 100, 1, 0, 37, 1);
+    CHECK(count_space_filling_jumps(tbb::hilbert_order(uneven)) < count_space_filling_jumps(tbb::morton_order(uneven)) / 2);
+}
+
+//! \brief \ref requirement
+TEST_CASE("Morton order visits the leaves in Z-order") {
+    const int size = 16;
+    std::vector<tbb::blocked_range2d<int>> order;
+    tbb::task_arena arena(1);
+    arena.execute([&] {
+        tbb::parallel_for(tbb::morton_order(tbb::blocked_range2d<int>(0, size, 1, 0, size, 1)),
+            [&]( const tbb::blocked_range2d<int>& r ) { order.push_back(r); }, tbb::simple_partitioner());
+    });
+    REQUIRE(order.size() == std::size_t(size * size));
+    for (std::size_t k = 0; k < order.size(); ++k) {
+        // The rows take the odd bits of the position on the curve and the columns take the even ones
+        int row = 0, col = 0;
+        for (int b = 0; (std::size_t(1) << 2 * b) < order.size(); ++b) {
+            col |= int((k >> 2 * b) & 1) << b;
+            row |= int((k >> (2 * b + 1)) & 1) << b;
+        }
+        CHECK(order[k].rows().begin() == row);
+        CHECK(order[k].cols().begin() == col);
+    }
+
+    // The column that can no longer be split is skipped; the wrapped range would split the rows
+    // down to 2 x 2 first and visit (0, 0), (0, 1), (1, 0), (1, 1)
+    order.clear();
+    arena.execute([&] {
+        tbb::parallel_for(tbb::morton_order(tbb::blocked_range2d<int>(0, 8, 1, 0, 2, 1)),
+            [&]( const tbb::blocked_range2d<int>& r ) { order.push_back(r); }, tbb::simple_partitioner());
+    });
+    REQUIRE(order.size() == 16);
+    for (std::size_t k = 0; k < order.size(); ++k) {
+        CHECK(order[k].rows().begin() == int(k / 8 * 4 + k % 4));
+        CHECK(order[k].cols().begin() == int(k / 4 % 2));
+    }
+}
+
+//! \brief \ref interface
+TEST_CASE("space_filling_range splitting") {
+    tbb::blocked_range2d<int> range(0, 16, 1, 0, 16, 1);
+    auto r = tbb::hilbert_order(range);
+    REQUIRE(r.is_divisible());
+    REQUIRE(!r.empty());
+    const tbb::blocked_range2d<int>& base = r;
+    REQUIRE(&base == &r.base());
+
+    // The first subrange starts at the origin and the second one is its neighbor
+    decltype(r) second(r, tbb::split());
+    REQUIRE(r.base().rows().begin() == 0);
+    REQUIRE(r.base().cols().begin() == 0);
+    REQUIRE(r.base().rows().size() * r.base().cols().size() == 128);
+    REQUIRE(second.base().rows().size() * second.base().cols().size() == 128);
+
+    tbb::proportional_split p(1, 3);
+    decltype(r) third(second, p);
+    std::size_t first_part = second.base().rows().size() * second.base().cols().size();
+    std::size_t second_part = third.base().rows().size() * third.base().cols().size();
+    REQUIRE(first_part + second_part == 128);
+    REQUIRE(first_part * 3 == second_part);
+}
@@ -0,0 +1,198 @@
+/*
+    Copyright (c) 2025 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#define TBB_PREVIEW_FLOW_GRAPH_BATCHING 1
+
+#include "common/config.h"
+
+#include "tbb/flow_graph.h"
+#include "tbb/global_control.h"
+
+#include "common/test.h"
+#include "common/utils.h"
+#include "common/spin_barrier.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+//! \file test_flow_graph_batching.cpp
+//! \brief Test for [preview] functionality of the flow graph nodes that process batches of messages
+
+//! Checks that batch_function_node forms batches of queued messages and forwards all the outputs
+void test_batch_function_node( size_t concurrency, size_t max_batch_size ) {
+    const int num_messages = 1000;
+    tbb::flow::graph g;
+    std::atomic<bool> all_put{false};
+    std::atomic<size_t> num_calls{0};
+    std::atomic<size_t> num_running{0};
+    std::atomic<size_t> max_running{0};
+    std::atomic<bool> batch_size_exceeded{false};
+
+    tbb::flow::batch_function_node<int, int> node(g, concurrency, max_batch_size,
+        [&]( const std::vector<int>& batch, std::vector<int>& outputs ) {
+            size_t running = ++num_running;
+            for (size_t m = max_running; m < running && !max_running.compare_exchange_weak(m, running); ) {}
+            if (num_calls++ == 0) {
+                // The first batch keeps the node busy so that the other messages are queued
+                utils::SpinWaitUntilEq(all_put, true);
+            }
+            if (batch.empty() || batch.size() > max_batch_size) {
+                batch_size_exceeded = true;
+            }
+            for (int v : batch) {
+                outputs.push_back(2 * v);
+            }
+            --num_running;
+        });
+    CHECK(node.max_batch_size() == max_batch_size);
+
+    std::atomic<long> sum{0};
+    std::atomic<int> count{0};
+    tbb::flow::function_node<int> sink(g, tbb::flow::unlimited, [&]( int v ) noexcept {
+        sum += v;
+        ++count;
+    });
+    tbb::flow::make_edge(node, sink);
+
+    for (int i = 0; i < num_messages; ++i) {
+        CHECK(node.try_put(i));
+    }
+    all_put = true;
+    g.wait_for_all();
+
+    CHECK(count == num_messages);
+    CHECK(sum == long(num_messages) * (num_messages - 1));
+    CHECK_FALSE(batch_size_exceeded);
+    if (concurrency == tbb::flow::serial) {
+        CHECK(max_running == 1);
+        // Every batch except the first one is full
+        CHECK(num_calls <= 2 + (num_messages - 1) / max_batch_size);
+    } else if (concurrency != tbb::flow::unlimited) {
+        CHECK(max_running <= concurrency);
+    }
+
+    // The node is reusable after reset
+    g.reset();
+    all_put = true;
+    num_calls = 1;
+    count = 0;
+    for (int i = 0; i < 10; ++i) {
+        node.try_put(i);
+    }
+    g.wait_for_all();
+    CHECK(count == 10);
+}
+
+void test_batch_function_node_all() {
+    for (size_t concurrency : { size_t(tbb::flow::serial), size_t(2), size_t(tbb::flow::unlimited) }) {
+        for (size_t max_batch_size : { 1, 8, 64 }) {
+            test_batch_function_node(concurrency, max_batch_size);
+        }
+    }
+}
+#if TBB_USE_EXCEPTIONS
+//! Checks that a node whose body threw accepts and processes new messages without a reset
+void test_batch_function_node_exception() {
+    tbb::flow::graph g;
+    std::atomic<bool> do_throw{true};
+    tbb::flow::batch_function_node<int, int> node(g, tbb::flow::serial, 8,
+        [&]( const std::vector<int>& batch, std::vector<int>& outputs ) {
+            if (do_throw) {
+                throw std::runtime_error("batch");
+            }
+            outputs = batch;
+        });
+    std::atomic<int> count{0};
+    tbb::flow::function_node<int> sink(g, tbb::flow::unlimited, [&]( int ) noexcept { ++count; });
+    tbb::flow::make_edge(node, sink);
+
+    node.try_put(0);
+    bool caught = false;
+    try {
+        g.wait_for_all();
+    } catch (const std::runtime_error& e) {
+        caught = std::string(e.what()) == "batch";
+    }
+    CHECK(caught);
+
+    // The serial node would not start a new task if the failed one was still counted
+    do_throw = false;
+    for (int i = 0; i < 10; ++i) {
+        node.try_put(i);
+    }
+    g.wait_for_all();
+    CHECK(count == 10);
+}
+#endif // TBB_USE_EXCEPTIONS
+
+//! \brief \ref requirement
+TEST_CASE("batch_function_node applies the body to batches of messages") {
+    test_batch_function_node_all();
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, 4);
+    tbb::task_arena arena(4);
+    arena.execute(test_batch_function_node_all);
+}
+
+//! \brief \ref requirement
+TEST_CASE("batch_multifunction_node applies the body to batches of messages") {
+    using node_type = tbb::flow::batch_multifunction_node<int, std::tuple<int, int>>;
+    const int num_messages = 1000;
+    const std::size_t max_batch_size = 16;
+    tbb::flow::graph g;
+    std::atomic<std::size_t> num_calls{0};
+    std::atomic<bool> batch_size_exceeded{false};
+
+    node_type node(g, tbb::flow::serial, max_batch_size,
+        [&]( const std::vector<int>& batch, node_type::output_ports_type& ports ) {
+            ++num_calls;
+            if (batch.empty() || batch.size() > max_batch_size) {
+                batch_size_exceeded = true;
+            }
+            for (int v : batch) {
+                if (v % 2 == 0) {
+                    std::get<0>(ports).try_put(v);
+                } else {
+                    std::get<1>(ports).try_put(v);
+                }
+            }
+        });
+
+    std::atomic<int> num_even{0}, num_odd{0};
+    tbb::flow::function_node<int> even(g, tbb::flow::unlimited, [&]( int v ) { CHECK(v % 2 == 0); ++num_even; });
+    tbb::flow::function_node<int> odd(g, tbb::flow::unlimited, [&]( int v ) { CHECK(v % 2 == 1); ++num_odd; });
+    tbb::flow::make_edge(tbb::flow::output_port<0>(node), even);
+    tbb::flow::make_edge(tbb::flow::output_port<1>(node), odd);
+
+    for (int i = 0; i < num_messages; ++i) {
+        CHECK(node.try_put(i));
+    }
+    g.wait_for_all();
+
+    CHECK(num_even == num_messages / 2);
+    CHECK(num_odd == num_messages / 2);
+    CHECK(num_calls <= std::size_t(num_messages));
+    CHECK_FALSE(batch_size_exceeded);
+}
+
+#if TBB_USE_EXCEPTIONS
+//! \brief \ref error_guessing
+TEST_CASE("batch_function_node after an exception in the body") {
+    test_batch_function_node_exception();
+}
+#endif
@@ -0,0 +1,215 @@
+/*
+    Copyright (c) 2025 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#define TBB_PREVIEW_FLOW_GRAPH_COPY_ON_WRITE_SUCCESSORS 1
+
+#include "common/config.h"
+
+#include "tbb/flow_graph.h"
+
+#include "common/test.h"
+#include "common/utils.h"
+
+#include <atomic>
+#include <vector>
+
+//! \file test_flow_graph_cow_successors.cpp
+//! \brief Test for [preview] functionality of copy-on-write successor lists
+
+#define TBB_INTERNAL_NAMESPACE detail::d2
+namespace tbb {
+using task = TBB_INTERNAL_NAMESPACE::graph_task;
+}
+using tbb::TBB_INTERNAL_NAMESPACE::SUCCESSFULLY_ENQUEUED;
+
+const int N = 1000;
+
+//! Counts the messages received for every value
+template <typename T>
+class counting_array_receiver : public tbb::flow::receiver<T> {
+    std::atomic<std::size_t> my_counters[N];
+    tbb::flow::graph& my_graph;
+
+public:
+    counting_array_receiver( tbb::flow::graph& g ) : my_graph(g) {
+        for (int i = 0; i < N; ++i) {
+            my_counters[i] = 0;
+        }
+    }
+
+    std::size_t operator[]( int i ) {
+        return my_counters[i];
+    }
+
+    tbb::task* try_put_task( const T& v ) override {
+        ++my_counters[(int)v];
+        return const_cast<tbb::task*>(SUCCESSFULLY_ENQUEUED);
+    }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+    tbb::task* try_put_task( const T& v, const tbb::detail::d2::message_metainfo& ) override {
+        return try_put_task(v);
+    }
+#endif
+
+    tbb::flow::graph& graph_reference() const override {
+        return my_graph;
+    }
+};
+
+//! Rejects all messages and counts the switches of its predecessors to the pull protocol
+class rejecting_receiver : public tbb::flow::receiver<int> {
+    tbb::flow::graph& my_graph;
+public:
+    std::atomic<int> my_num_rejected{0};
+    std::atomic<int> my_num_predecessors{0};
+
+    rejecting_receiver( tbb::flow::graph& g ) : my_graph(g) {}
+
+    tbb::task* try_put_task( const int& ) override {
+        ++my_num_rejected;
+        return nullptr;
+    }
+
+#if __TBB_PREVIEW_FLOW_GRAPH_TRY_PUT_AND_WAIT
+    tbb::task* try_put_task( const int& v, const tbb::detail::d2::message_metainfo& ) override {
+        return try_put_task(v);
+    }
+#endif
+
+    bool register_predecessor( predecessor_type& ) override {
+        ++my_num_predecessors;
+        return true;
+    }
+
+    tbb::flow::graph& graph_reference() const override {
+        return my_graph;
+    }
+};
+
+//! Messages are forwarded to a snapshot of the successors while the edges change
+void test_concurrent_edge_changes() {
+    const int num_senders = 3;
+    tbb::flow::graph g;
+    tbb::flow::broadcast_node<int> b(g);
+    counting_array_receiver<int> stable(g), changing(g);
+    tbb::flow::make_edge(b, stable);
+
+    std::atomic<int> num_done{0};
+    utils::NativeParallelFor(num_senders + 1, [&]( int t ) {
+        if (t < num_senders) {
+            for (int n = t; n < N; n += num_senders) {
+                CHECK(b.try_put(n));
+            }
+            ++num_done;
+        } else {
+            while (num_done < num_senders) {
+                tbb::flow::make_edge(b, changing);
+                tbb::flow::remove_edge(b, changing);
+            }
+        }
+    });
+    g.wait_for_all();
+
+    for (int n = 0; n < N; ++n) {
+        CHECK(stable[n] == 1);
+        CHECK(changing[n] <= 1);
+    }
+}
+
+//! Concurrent senders rejected by the same successor switch it to the pull protocol once
+void test_concurrent_rejections() {
+    const int num_senders = 4;
+    tbb::flow::graph g;
+    tbb::flow::broadcast_node<int> b(g);
+    rejecting_receiver rejecting(g);
+    counting_array_receiver<int> accepting(g);
+    for (int repeat = 0; repeat < 10; ++repeat) {
+        tbb::flow::make_edge(b, rejecting);
+        tbb::flow::make_edge(b, accepting);
+        rejecting.my_num_predecessors = 0;
+        utils::NativeParallelFor(num_senders, [&]( int t ) {
+            for (int n = t; n < N; n += num_senders) {
+                b.try_put(n);
+            }
+        });
+        CHECK(rejecting.my_num_predecessors == 1);
+        CHECK(rejecting.my_num_rejected >= 1);
+        tbb::flow::remove_edge(b, accepting);
+    }
+    g.wait_for_all();
+    for (int n = 0; n < N; ++n) {
+        CHECK(accepting[n] == 10);
+    }
+}
+
+//! A queue_node passes every message to one of its successors while the edges change
+void test_queue_with_edge_changes() {
+    tbb::flow::graph g;
+    tbb::flow::queue_node<int> q(g);
+    std::atomic<int> received{0};
+    tbb::flow::function_node<int> stable(g, tbb::flow::unlimited, [&]( int ) { ++received; });
+    tbb::flow::function_node<int> changing(g, tbb::flow::unlimited, [&]( int ) { ++received; });
+    tbb::flow::make_edge(q, stable);
+
+    std::atomic<bool> done{false};
+    utils::NativeParallelFor(2, [&]( int t ) {
+        if (t == 0) {
+            for (int n = 0; n < N; ++n) {
+                CHECK(q.try_put(n));
+            }
+            done = true;
+        } else {
+            while (!done) {
+                tbb::flow::make_edge(q, changing);
+                tbb::flow::remove_edge(q, changing);
+            }
+        }
+    });
+    g.wait_for_all();
+    CHECK(received == N);
+}
+
+//! A continue_node signals every successor once
+void test_continue_fan_out() {
+    const int num_successors = 5;
+    tbb::flow::graph g;
+    tbb::flow::continue_node<tbb::flow::continue_msg> start(g, []( const tbb::flow::continue_msg& m ) { return m; });
+    std::atomic<int> signals{0};
+    std::vector<tbb::flow::continue_node<tbb::flow::continue_msg>> successors;
+    successors.reserve(num_successors);
+    for (int i = 0; i < num_successors; ++i) {
+        successors.emplace_back(g, [&]( const tbb::flow::continue_msg& m ) { ++signals; return m; });
+        tbb::flow::make_edge(start, successors.back());
+    }
+    for (int repeat = 0; repeat < 10; ++repeat) {
+        start.try_put(tbb::flow::continue_msg());
+        g.wait_for_all();
+    }
+    CHECK(signals == 10 * num_successors);
+}
+
+//! \brief \ref error_guessing
+TEST_CASE("Copy-on-write successors with concurrent senders") {
+    test_concurrent_edge_changes();
+    test_concurrent_rejections();
+}
+
+//! \brief \ref requirement
+TEST_CASE("Copy-on-write successors of queue_node and continue_node") {
+    test_queue_with_edge_changes();
+    test_continue_fan_out();
+}
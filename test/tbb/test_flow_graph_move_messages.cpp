@@ -0,0 +1,129 @@
+/*
+    Copyright (c) 2025 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#define TBB_PREVIEW_FLOW_GRAPH_MOVE_MESSAGES 1
+
+#include "common/config.h"
+
+#include "tbb/flow_graph.h"
+
+#include "common/test.h"
+#include "common/utils.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+//! \file test_flow_graph_move_messages.cpp
+//! \brief Test for [preview] functionality of moving messages through flow graph nodes
+
+const int N = 1000;
+
+//! A message that counts its copies
+struct copy_counted {
+    static std::atomic<int> copies;
+
+    int value;
+
+    copy_counted( int v = 0 ) : value(v) {}
+    copy_counted( const copy_counted& other ) : value(other.value) { ++copies; }
+    copy_counted( copy_counted&& other ) : value(other.value) { other.value = -1; }
+    copy_counted& operator=( const copy_counted& other ) { value = other.value; ++copies; return *this; }
+    copy_counted& operator=( copy_counted&& other ) { value = other.value; other.value = -1; return *this; }
+};
+
+std::atomic<int> copy_counted::copies{0};
+
+using unique_int = std::unique_ptr<int>;
+
+//! \brief \ref requirement
+TEST_CASE("queue_node passes move-only messages") {
+    tbb::flow::graph g;
+    tbb::flow::queue_node<unique_int> q(g);
+    tbb::flow::buffer_node<unique_int> b(g);
+    tbb::flow::make_edge(q, b);
+
+    for (int i = 0; i < N; ++i) {
+        CHECK(q.try_put(unique_int(new int(i))));
+    }
+    g.wait_for_all();
+
+    std::vector<bool> received(N, false);
+    unique_int p;
+    while (b.try_get(p)) {
+        REQUIRE(p);
+        CHECK(!received[*p]);
+        received[*p] = true;
+    }
+    for (int i = 0; i < N; ++i) {
+        CHECK(received[i]);
+    }
+
+    tbb::flow::remove_edge(q, b);
+    CHECK(q.try_put(unique_int(new int(1))));
+    // The items that stay in the buffer cannot be reserved without a copy
+    CHECK(!q.try_reserve(p));
+    unique_int lvalue(new int(2));
+    CHECK_MESSAGE(!q.try_put(lvalue), "A move-only item put by reference must be rejected");
+    CHECK(lvalue);
+    CHECK(q.try_get(p));
+    CHECK(*p == 1);
+    CHECK(!q.try_get(p));
+    g.wait_for_all();
+}
+
+//! \brief \ref requirement
+TEST_CASE("priority_queue_node passes move-only messages") {
+    struct less_value {
+        bool operator()( const unique_int& a, const unique_int& b ) const { return *a < *b; }
+    };
+    tbb::flow::graph g;
+    tbb::flow::priority_queue_node<unique_int, less_value> pq(g);
+    for (int i = 0; i < N; ++i) {
+        CHECK(pq.try_put(unique_int(new int((i * 7) % N))));
+    }
+    g.wait_for_all();
+    unique_int p;
+    CHECK(!pq.try_reserve(p));
+    for (int i = N - 1; i >= 0; --i) {
+        REQUIRE(pq.try_get(p));
+        CHECK(*p == i);
+    }
+    CHECK(!pq.try_get(p));
+}
+
+//! \brief \ref requirement
+TEST_CASE("Messages are moved through queue_node") {
+    copy_counted::copies = 0;
+    tbb::flow::graph g;
+    std::atomic<int> sum{0};
+    tbb::flow::function_node<int, copy_counted> producer(g, tbb::flow::unlimited, []( int i ) {
+        return copy_counted(i);
+    });
+    tbb::flow::queue_node<copy_counted> q(g);
+    tbb::flow::function_node<copy_counted> consumer(g, tbb::flow::serial, [&sum]( const copy_counted& c ) {
+        sum += c.value;
+    });
+    tbb::flow::make_edge(producer, q);
+    tbb::flow::make_edge(q, consumer);
+
+    for (int i = 0; i < N; ++i) {
+        producer.try_put(i);
+    }
+    g.wait_for_all();
+    CHECK(sum == N * (N - 1) / 2);
+    CHECK(copy_counted::copies == 0);
+}
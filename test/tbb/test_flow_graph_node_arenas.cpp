@@ -0,0 +1,186 @@
+/*
+    Copyright (c) 2025 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#define TBB_PREVIEW_FLOW_GRAPH_NODE_ARENAS 1
+#define TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION 1
+
+#include "common/config.h"
+
+#include "tbb/flow_graph.h"
+#include "tbb/global_control.h"
+
+#include "common/test.h"
+#include "common/utils.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+
+//! \file test_flow_graph_node_arenas.cpp
+//! \brief Test for [preview] functionality of binding flow graph nodes to task arenas
+
+// The arenas of the graph and of the nodes are told apart by their concurrency
+const int graph_concurrency = 4;
+
+//! Records the concurrency of the arena that executes each call
+struct arena_recorder {
+    std::atomic<int> calls{0};
+    std::atomic<int> wrong_arena{0};
+    int expected{graph_concurrency};
+
+    void record() {
+        ++calls;
+        if (tbb::this_task_arena::max_concurrency() != expected) {
+            ++wrong_arena;
+        }
+    }
+
+    void expect(int concurrency) {
+        calls = 0;
+        wrong_arena = 0;
+        expected = concurrency;
+    }
+};
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("nodes bound to task arenas") {
+    using namespace tbb::flow;
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, 4);
+    tbb::task_arena graph_arena(graph_concurrency);
+    tbb::task_arena arena_a(2);
+    tbb::task_arena arena_b(3);
+    graph_arena.execute([&] {
+        const int N = 100;
+        arena_recorder source_calls, compute_calls, io_calls, split_calls, done_calls, urgent_calls;
+        graph g;
+        int n = 0;
+        input_node<int> source(g, [&](tbb::flow_control& fc) {
+            source_calls.record();
+            if (n == N) {
+                fc.stop();
+            }
+            return n++;
+        });
+        function_node<int, int> compute(g, unlimited, [&](int i) { compute_calls.record(); return i; });
+        function_node<int, continue_msg> io(g, serial, [&](int) { io_calls.record(); return continue_msg(); });
+        multifunction_node<int, std::tuple<int>> split(g, unlimited, [&](int i, multifunction_node<int, std::tuple<int>>::output_ports_type& ports) {
+            split_calls.record();
+            std::get<0>(ports).try_put(i);
+        });
+        continue_node<continue_msg, lightweight> done(g, [&](const continue_msg&) {
+            done_calls.record();
+            return continue_msg();
+        });
+        function_node<int> urgent(g, serial, [&](int) { urgent_calls.record(); }, node_priority_t(1));
+        make_edge(source, compute);
+        make_edge(compute, io);
+        make_edge(compute, split);
+        make_edge(io, done);
+        make_edge(split, urgent);
+
+        auto run = [&](int a, int b) {
+            for (arena_recorder* r : { &source_calls, &split_calls, &urgent_calls }) {
+                r->expect(a);
+            }
+            for (arena_recorder* r : { &io_calls, &done_calls }) {
+                r->expect(b);
+            }
+            compute_calls.expect(graph_concurrency);
+            n = 0;
+            source.activate();
+            g.wait_for_all();
+            g.reset();
+            CHECK(source_calls.calls == N + 1);
+            for (arena_recorder* r : { &compute_calls, &io_calls, &split_calls, &done_calls, &urgent_calls }) {
+                CHECK(r->calls == N);
+            }
+            for (arena_recorder* r : { &source_calls, &compute_calls, &io_calls, &split_calls, &done_calls, &urgent_calls }) {
+                CHECK(r->wrong_arena == 0);
+            }
+        };
+
+        bind_to_arena(arena_a, source, split, urgent);
+        bind_to_arena(arena_b, io, done);
+        // The bound nodes are neither fused nor executed inline
+        CHECK(fuse_serial_chains(g) == 0);
+        run(2, 3);
+
+        unbind_from_arena(source, io, split, done, urgent);
+        run(graph_concurrency, graph_concurrency);
+    });
+}
+
+#if TBB_USE_EXCEPTIONS
+//! \brief \ref error_guessing
+TEST_CASE("exception in a node bound to a task arena") {
+    using namespace tbb::flow;
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, 4);
+    tbb::task_arena arena(2);
+    graph g;
+    std::atomic<int> calls{0};
+    function_node<int> thrower(g, unlimited, [&](int i) {
+        ++calls;
+        if (i == 5) {
+            throw std::runtime_error("bound node");
+        }
+    });
+    bind_to_arena(arena, thrower);
+    for (int i = 0; i < 10; ++i) {
+        thrower.try_put(i);
+    }
+    bool caught = false;
+    try {
+        g.wait_for_all();
+    } catch (const std::runtime_error& e) {
+        caught = std::string(e.what()) == "bound node";
+    }
+    CHECK(caught);
+    CHECK(g.is_cancelled());
+
+    g.reset();
+    calls = 0;
+    for (int i = 10; i < 20; ++i) {
+        thrower.try_put(i);
+    }
+    g.wait_for_all();
+    CHECK(calls == 10);
+}
+#endif // TBB_USE_EXCEPTIONS
+
+#if TBB_USE_EXCEPTIONS && !TBB_USE_ASSERT
+// With assertions enabled, bind_to_arena asserts before it throws
+//! \brief \ref error_guessing
+TEST_CASE("bind_to_arena rejects an arena without slots for worker threads") {
+    using namespace tbb::flow;
+    graph g;
+    std::atomic<int> calls{0};
+    function_node<int> node(g, unlimited, [&](int) { ++calls; });
+    for (int reserved : { 1, 2 }) {
+        tbb::task_arena arena(reserved, reserved);
+        CHECK_THROWS_AS(bind_to_arena(arena, node), std::invalid_argument);
+    }
+    // The node stays in the arena of the graph
+    for (int i = 0; i < 10; ++i) {
+        node.try_put(i);
+    }
+    g.wait_for_all();
+    CHECK(calls == 10);
+
+    tbb::task_arena workers_only(1, 0);
+    CHECK_NOTHROW(bind_to_arena(workers_only, node));
+    unbind_from_arena(node);
+}
+#endif
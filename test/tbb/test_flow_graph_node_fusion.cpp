@@ -0,0 +1,234 @@
+/*
+    Copyright (c) 2025 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#define TBB_PREVIEW_FLOW_GRAPH_NODE_FUSION 1
+
+#include "common/config.h"
+
+#include "tbb/flow_graph.h"
+#include "tbb/global_control.h"
+
+#include "common/test.h"
+#include "common/utils.h"
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+//! \file test_flow_graph_node_fusion.cpp
+//! \brief Test for [preview] functionality of fusing serial chains of flow graph nodes
+
+using fusion_node_type = tbb::flow::function_node<int, int>;
+
+void test_fusion_candidates() {
+    tbb::flow::graph g;
+    auto body = []( int v ) noexcept { return v; };
+    std::vector<std::unique_ptr<fusion_node_type>> chain;
+    for (int i = 0; i < 6; ++i) {
+        chain.emplace_back(new fusion_node_type(g, tbb::flow::serial, body));
+        if (i > 0) {
+            tbb::flow::make_edge(*chain[i - 1], *chain[i]);
+        }
+    }
+    CHECK(tbb::flow::fuse_serial_chains(g) == 5);
+
+    // A node with two successors keeps broadcasting
+    fusion_node_type other(g, tbb::flow::unlimited, body);
+    tbb::flow::make_edge(*chain[2], other);
+    CHECK(tbb::flow::fuse_serial_chains(g) == 4);
+
+    // Neither a rejecting successor nor a lightweight predecessor is fused
+    tbb::flow::function_node<int, int, tbb::flow::rejecting> rejecting(g, tbb::flow::serial, body);
+    tbb::flow::make_edge(other, rejecting);
+    tbb::flow::function_node<int, int, tbb::flow::lightweight> lightweight_node(g, tbb::flow::serial, body);
+    tbb::flow::make_edge(lightweight_node, *chain[0]);
+    CHECK(tbb::flow::fuse_serial_chains(g) == 4);
+
+    // A successor with a body that may throw is not fused
+    fusion_node_type throwing(g, tbb::flow::serial, []( int v ) { return v; });
+    tbb::flow::make_edge(rejecting, throwing);
+    CHECK(tbb::flow::fuse_serial_chains(g) == 4);
+
+    // The edges of a cycle are not fused, while an edge leading into the cycle is
+    fusion_node_type entry(g, tbb::flow::serial, body);
+    fusion_node_type loop_first(g, tbb::flow::unlimited, body);
+    fusion_node_type loop_second(g, tbb::flow::unlimited, body);
+    tbb::flow::make_edge(entry, loop_first);
+    tbb::flow::make_edge(loop_first, loop_second);
+    tbb::flow::make_edge(loop_second, loop_first);
+    CHECK(tbb::flow::fuse_serial_chains(g) == 5);
+
+    // Chains of continue nodes are fused as well
+    tbb::flow::continue_node<tbb::flow::continue_msg> c0(g, []( tbb::flow::continue_msg ) { return tbb::flow::continue_msg(); });
+    tbb::flow::continue_node<tbb::flow::continue_msg> c1(g, []( tbb::flow::continue_msg ) { return tbb::flow::continue_msg(); });
+    tbb::flow::continue_node<int> c2(g, []( tbb::flow::continue_msg ) { return 1; });
+    tbb::flow::make_edge(c0, c1);
+    tbb::flow::make_edge(c1, c2);
+    tbb::flow::make_edge(c2, entry);
+    CHECK(tbb::flow::fuse_serial_chains(g) == 8);
+
+    tbb::flow::remove_edge(*chain[2], other);
+    tbb::flow::remove_edge(*chain[4], *chain[5]);
+    CHECK(tbb::flow::fuse_serial_chains(g) == 8);
+    g.reset(tbb::flow::rf_clear_edges);
+    CHECK(tbb::flow::fuse_serial_chains(g) == 0);
+}
+
+//! Checks that a fused chain delivers every message and keeps the concurrency limits of the nodes
+void test_fused_chain( size_t concurrency ) {
+    const int num_stages = 6;
+    const int num_messages = 1000;
+    tbb::flow::graph g;
+    std::vector<std::atomic<int>> running(num_stages);
+    std::vector<std::atomic<int>> max_running(num_stages);
+    for (int i = 0; i < num_stages; ++i) {
+        running[i] = 0;
+        max_running[i] = 0;
+    }
+
+    std::vector<std::unique_ptr<fusion_node_type>> chain;
+    for (int i = 0; i < num_stages; ++i) {
+        chain.emplace_back(new fusion_node_type(g, concurrency, [&running, &max_running, i]( int v ) noexcept {
+            int r = ++running[i];
+            for (int m = max_running[i]; m < r && !max_running[i].compare_exchange_weak(m, r); ) {}
+            std::this_thread::yield();
+            --running[i];
+            return v + 1;
+        }));
+        if (i > 0) {
+            tbb::flow::make_edge(*chain[i - 1], *chain[i]);
+        }
+    }
+    std::atomic<long> sum{0};
+    std::atomic<int> count{0};
+    tbb::flow::function_node<int> sink(g, tbb::flow::unlimited, [&]( int v ) noexcept {
+        sum += v;
+        ++count;
+    });
+    tbb::flow::make_edge(*chain.back(), sink);
+    CHECK(tbb::flow::fuse_serial_chains(g) == num_stages);
+
+    for (int i = 0; i < num_messages; ++i) {
+        chain.front()->try_put(i);
+    }
+    g.wait_for_all();
+
+    CHECK(count == num_messages);
+    CHECK(sum == long(num_messages) * (num_messages - 1) / 2 + long(num_messages) * num_stages);
+    if (concurrency != tbb::flow::unlimited) {
+        for (int i = 0; i < num_stages; ++i) {
+            CHECK(max_running[i] <= int(concurrency));
+        }
+    }
+}
+
+//! Checks that every message passes the stages of a fused chain in a single task
+void test_fused_chain_single_task() {
+    const int num_stages = 6;
+    const int num_messages = 1000;
+    tbb::flow::graph g;
+    std::vector<std::vector<std::thread::id>> ids(num_stages, std::vector<std::thread::id>(num_messages));
+
+    std::vector<std::unique_ptr<fusion_node_type>> chain;
+    for (int i = 0; i < num_stages; ++i) {
+        chain.emplace_back(new fusion_node_type(g, tbb::flow::unlimited, [&ids, i]( int v ) noexcept {
+            ids[i][v] = std::this_thread::get_id();
+            return v;
+        }));
+        if (i > 0) {
+            tbb::flow::make_edge(*chain[i - 1], *chain[i]);
+        }
+    }
+    CHECK(tbb::flow::fuse_serial_chains(g) == num_stages - 1);
+
+    for (int i = 0; i < num_messages; ++i) {
+        chain.front()->try_put(i);
+    }
+    g.wait_for_all();
+
+    for (int m = 0; m < num_messages; ++m) {
+        for (int i = 1; i < num_stages; ++i) {
+            CHECK(ids[i][m] == ids[0][m]);
+        }
+    }
+}
+
+#if TBB_USE_EXCEPTIONS
+//! Checks that an exception in a node after a fused chain cancels the graph
+//! and that the serial node accepts the messages after reset
+void test_fused_chain_exception() {
+    tbb::flow::graph g;
+    std::atomic<bool> do_throw{true};
+    std::atomic<int> count{0};
+    fusion_node_type first(g, tbb::flow::unlimited, []( int v ) noexcept { return v; });
+    fusion_node_type second(g, tbb::flow::unlimited, []( int v ) noexcept { return v; });
+    fusion_node_type third(g, tbb::flow::serial, [&]( int v ) {
+        if (do_throw && v == 10) {
+            throw std::runtime_error("fused node");
+        }
+        return v;
+    });
+    tbb::flow::function_node<int> sink(g, tbb::flow::serial, [&]( int ) noexcept { ++count; });
+    tbb::flow::make_edge(first, second);
+    tbb::flow::make_edge(second, third);
+    tbb::flow::make_edge(third, sink);
+    // The throwing body is executed by its own task
+    CHECK(tbb::flow::fuse_serial_chains(g) == 2);
+
+    for (int i = 0; i < 100; ++i) {
+        first.try_put(i);
+    }
+    bool caught = false;
+    try {
+        g.wait_for_all();
+    } catch (const std::runtime_error& e) {
+        caught = std::string(e.what()) == "fused node";
+    }
+    CHECK(caught);
+    CHECK(count < 100);
+
+    g.reset();
+    do_throw = false;
+    count = 0;
+    for (int i = 0; i < 100; ++i) {
+        first.try_put(i);
+    }
+    g.wait_for_all();
+    CHECK(count == 100);
+}
+#endif // TBB_USE_EXCEPTIONS
+
+void test_node_fusion() {
+    test_fusion_candidates();
+    test_fused_chain_single_task();
+    for (size_t concurrency : { size_t(tbb::flow::serial), size_t(2), size_t(tbb::flow::unlimited) }) {
+        test_fused_chain(concurrency);
+    }
+#if TBB_USE_EXCEPTIONS
+    test_fused_chain_exception();
+#endif
+}
+
+//! \brief \ref requirement
+TEST_CASE("fuse_serial_chains executes chains of nodes inline") {
+    test_node_fusion();
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, 4);
+    tbb::task_arena arena(4);
+    arena.execute(test_node_fusion);
+}
@@ -0,0 +1,151 @@
+/*
+    Copyright (c) 2025 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#define TBB_PREVIEW_FLOW_GRAPH_STATISTICS 1
+
+#include "common/config.h"
+
+#include "tbb/flow_graph.h"
+
+#include "common/test.h"
+#include "common/utils.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <tuple>
+
+//! \file test_flow_graph_statistics.cpp
+//! \brief Test for [preview] functionality of flow graph node statistics and graph_to_dot
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("node statistics") {
+    using namespace tbb::flow;
+    const int N = 100;
+    const std::size_t limit = 2;
+    graph g;
+    std::atomic<int> active{0};
+    std::atomic<int> max_active{0};
+    function_node<int, int> first(g, unlimited, [](int i) { return i; });
+    queue_node<int> queue(g);
+    function_node<int, int, rejecting> second(g, limit, [&](int i) {
+        int a = ++active;
+        for (int m = max_active; m < a && !max_active.compare_exchange_weak(m, a); ) {}
+        std::this_thread::yield();
+        --active;
+        return i;
+    });
+    make_edge(first, queue);
+    make_edge(queue, second);
+    for (int i = 0; i < N; ++i) {
+        first.try_put(i);
+    }
+    g.wait_for_all();
+
+    CHECK(first.statistics().messages_in() == N);
+    CHECK(first.statistics().rejections() == 0);
+    CHECK(first.statistics().messages_out() == N);
+    CHECK(first.statistics().body_calls() == N);
+    CHECK(first.statistics().concurrency_limit() == 0);
+    CHECK(first.statistics().utilization() == 0.);
+
+    CHECK(queue.statistics().messages_in() == N);
+    CHECK(queue.statistics().messages_out() == N);
+    CHECK(queue.statistics().max_queue_size() >= 1);
+    CHECK(queue.statistics().max_queue_size() <= std::size_t(N));
+
+    const node_statistics& s = second.statistics();
+    CHECK(s.messages_in() == N);
+    CHECK(s.body_calls() == N);
+    CHECK(s.max_concurrency() >= 1);
+    CHECK(s.max_concurrency() <= limit);
+    CHECK(int(s.max_concurrency()) >= max_active);
+    CHECK(s.concurrency_limit() == limit);
+    CHECK(s.body_time().count() >= 0);
+    CHECK(s.utilization() >= 0.);
+
+    second.statistics().reset();
+    CHECK(s.messages_in() == 0);
+    CHECK(s.body_calls() == 0);
+    CHECK(s.max_concurrency() == 0);
+}
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("limiter_node statistics") {
+    using namespace tbb::flow;
+    const std::size_t threshold = 3;
+    graph g;
+    limiter_node<int> limiter(g, threshold);
+    queue_node<int> queue(g);
+    make_edge(limiter, queue);
+    for (int i = 0; i < 10; ++i) {
+        limiter.try_put(i);
+    }
+    g.wait_for_all();
+    CHECK(limiter.statistics().messages_in() == threshold);
+    CHECK(limiter.statistics().rejections() == 10 - threshold);
+    CHECK(limiter.statistics().messages_out() == threshold);
+    CHECK(limiter.statistics().max_queue_size() == threshold);
+    CHECK(limiter.statistics().concurrency_limit() == threshold);
+
+    limiter.decrementer().try_put(continue_msg());
+    g.wait_for_all();
+    CHECK(limiter.try_put(10));
+    g.wait_for_all();
+    CHECK(limiter.statistics().messages_in() == threshold + 1);
+    CHECK(limiter.statistics().max_queue_size() == threshold);
+}
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("graph_to_dot") {
+    using namespace tbb::flow;
+    graph g;
+    int n = 0;
+    input_node<int> source(g, [&n](tbb::flow_control& fc) {
+        if (n == 5) {
+            fc.stop();
+        }
+        return n++;
+    });
+    function_node<int, int> square(g, serial, [](int i) { return i * i; });
+    broadcast_node<int> broadcast(g);
+    join_node<std::tuple<int, int>> join(g);
+    buffer_node<std::tuple<int, int>> results(g);
+    make_edge(source, square);
+    make_edge(source, broadcast);
+    make_edge(square, input_port<0>(join));
+    make_edge(broadcast, input_port<1>(join));
+    make_edge(join, results);
+    set_name(square, "square \"x\"");
+    source.activate();
+    g.wait_for_all();
+
+    std::string dot = graph_to_dot(g);
+    CHECK(dot.find("digraph G {") == 0);
+    CHECK(dot.find("square \\\"x\\\"\\nfunction_node") != std::string::npos);
+    CHECK(dot.find("input_node") != std::string::npos);
+    CHECK(dot.find("broadcast_node") != std::string::npos);
+    CHECK(dot.find("join_node") != std::string::npos);
+    CHECK(dot.find("buffer_node") != std::string::npos);
+    CHECK(dot.find("in 5, rejected 0, out 5") != std::string::npos);
+    CHECK(dot.find("concurrency 1 of 1") != std::string::npos);
+    // The nodes are listed in the order of construction
+    CHECK(dot.find("n0 -> n1;") != std::string::npos);
+    CHECK(dot.find("n0 -> n2;") != std::string::npos);
+    CHECK(dot.find("n1 -> n3 [headlabel=\"0\"];") != std::string::npos);
+    CHECK(dot.find("n2 -> n3 [headlabel=\"1\"];") != std::string::npos);
+    CHECK(dot.find("n3 -> n4;") != std::string::npos);
+}
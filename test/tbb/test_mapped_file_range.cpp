@@ -0,0 +1,183 @@
+/*
+    Copyright (c) 2025 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#define TBB_PREVIEW_MAPPED_FILE_RANGE 1
+
+#include "common/test.h"
+#include "common/utils.h"
+
+#include "tbb/mapped_file_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/parallel_reduce.h"
+#include "tbb/parallel_pipeline.h"
+#include "tbb/global_control.h"
+#include "tbb/task_arena.h"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+//! \file test_mapped_file_range.cpp
+//! \brief Test for [preview] functionality of mapped_file_range
+
+//! Numbers 1, ..., n written one per record
+std::string make_text( std::size_t n, char delimiter, bool trailing_delimiter ) {
+    std::string text;
+    for (std::size_t i = 1; i <= n; ++i) {
+        text += std::to_string(i);
+        if (i < n || trailing_delimiter) {
+            text += delimiter;
+        }
+    }
+    return text;
+}
+
+struct temporary_file {
+    std::string path;
+
+    temporary_file( const std::string& name, const std::string& contents ) : path(name) {
+        std::ofstream out(path, std::ios::binary);
+        out << contents;
+    }
+    ~temporary_file() {
+        std::remove(path.c_str());
+    }
+};
+
+struct record_stats {
+    std::size_t count;
+    std::size_t sum;
+    bool aligned;
+};
+
+//! Sums the records of the subranges; every subrange must start at a record
+struct sum_records {
+    const char* text_begin;
+
+    record_stats operator()( const tbb::mapped_file_range& r, record_stats s ) const {
+        if (r.begin() != text_begin && r.begin()[-1] != r.delimiter()) {
+            s.aligned = false;
+        }
+        r.for_each_record([&]( const char* first, const char* last ) {
+            ++s.count;
+            s.sum += std::stoul(std::string(first, last));
+        });
+        return s;
+    }
+};
+
+record_stats join_stats( const record_stats& lhs, const record_stats& rhs ) {
+    return record_stats{lhs.count + rhs.count, lhs.sum + rhs.sum, lhs.aligned && rhs.aligned};
+}
+
+template <typename Partitioner>
+record_stats reduce_records( const tbb::mapped_file_range& range, Partitioner&& partitioner ) {
+    return tbb::parallel_reduce(range, record_stats{0, 0, true}, sum_records{range.begin()}, join_stats,
+                                std::forward<Partitioner>(partitioner));
+}
+
+void check_stats( const record_stats& s, std::size_t n ) {
+    CHECK(s.aligned);
+    CHECK(s.count == n);
+    CHECK(s.sum == n * (n + 1) / 2);
+}
+
+void test_file( std::size_t n, char delimiter, bool trailing_delimiter ) {
+    temporary_file file("test_mapped_file_range.tmp", make_text(n, delimiter, trailing_delimiter));
+    tbb::mapped_file mapped(file.path);
+    REQUIRE(mapped.is_open());
+    mapped.advise(tbb::file_access_hint::sequential);
+
+    for (std::size_t grainsize : { 1, 16, 4096 }) {
+        tbb::mapped_file_range range(mapped, grainsize, delimiter);
+        CHECK(range.size() == mapped.size());
+        check_stats(reduce_records(range, tbb::auto_partitioner()), n);
+        check_stats(reduce_records(range, tbb::simple_partitioner()), n);
+        check_stats(reduce_records(range, tbb::static_partitioner()), n);
+        tbb::affinity_partitioner ap;
+        check_stats(reduce_records(range, ap), n);
+        check_stats(reduce_records(range, ap), n);
+    }
+
+    // Chunks taken from the front feed a pipeline
+    tbb::mapped_file_range rest(mapped, tbb::mapped_file_range::default_grainsize, delimiter);
+    std::atomic<std::size_t> count{0}, sum{0};
+    tbb::parallel_pipeline(8,
+        tbb::make_filter<void, tbb::mapped_file_range>(tbb::filter_mode::serial_in_order,
+            [&]( tbb::flow_control& fc ) {
+                if (rest.empty()) {
+                    fc.stop();
+                    return rest;
+                }
+                return rest.take_front(100);
+            }) &
+        tbb::make_filter<tbb::mapped_file_range, void>(tbb::filter_mode::parallel,
+            [&]( const tbb::mapped_file_range& chunk ) {
+                chunk.advise(tbb::file_access_hint::willneed);
+                record_stats s = sum_records{mapped.begin()}(chunk, record_stats{0, 0, true});
+                CHECK(s.aligned);
+                count += s.count;
+                sum += s.sum;
+            }));
+    CHECK(count == n);
+    CHECK(sum == n * (n + 1) / 2);
+}
+
+void test_all() {
+    for (std::size_t n : { 1, 2, 100, 100000 }) {
+        test_file(n, '\n', true);
+        test_file(n, ';', false);
+    }
+}
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("mapped_file_range splits on record boundaries") {
+    test_all();
+}
+
+//! \brief \ref requirement
+TEST_CASE("mapped_file_range in a multi-threaded arena") {
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, 4);
+    tbb::task_arena arena(4);
+    arena.execute(test_all);
+}
+
+//! \brief \ref interface \ref error_guessing
+TEST_CASE("mapped_file with missing, empty and long-record files") {
+    tbb::mapped_file missing("test_mapped_file_range.missing");
+    CHECK(!missing.is_open());
+
+    temporary_file empty("test_mapped_file_range.tmp", "");
+    tbb::mapped_file mapped(empty.path);
+    CHECK(mapped.is_open());
+    CHECK(mapped.size() == 0);
+    tbb::mapped_file_range range(mapped, 1);
+    CHECK(range.empty());
+    CHECK(!range.is_divisible());
+
+    // A range that holds one record is not divisible regardless of its size
+    std::string record(1000, 'x');
+    tbb::mapped_file_range one(record.data(), record.data() + record.size(), 1);
+    CHECK(!one.is_divisible());
+    record += '\n';
+    tbb::mapped_file_range one_with_delimiter(record.data(), record.data() + record.size(), 1);
+    CHECK(!one_with_delimiter.is_divisible());
+
+    tbb::mapped_file moved(std::move(mapped));
+    CHECK(moved.is_open());
+    CHECK(!mapped.is_open());
+}
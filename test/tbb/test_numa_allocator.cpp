@@ -0,0 +1,192 @@
+/*
+    Copyright (c) 2025 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#define TBB_PREVIEW_NUMA_ALLOCATOR 1
+
+#include "common/test.h"
+#include "common/utils.h"
+
+#include "tbb/numa_allocator.h"
+#include "tbb/global_control.h"
+#include "tbb/task_arena.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+//! \file test_numa_allocator.cpp
+//! \brief Test for [preview] functionality of numa_allocator and parallel_first_touch
+
+//! Records how it was constructed
+struct tracked {
+    static std::atomic<std::size_t> default_constructed;
+    int value;
+    int thread;
+    int arena_concurrency;
+
+    tracked() : value(-1), thread(-1), arena_concurrency(-1) { ++default_constructed; }
+    tracked( int v ) : tracked(v, 0) {}
+    tracked( int v, int w ) : value(v + w), thread(tbb::this_task_arena::current_thread_index()),
+                              arena_concurrency(tbb::this_task_arena::max_concurrency()) {}
+};
+std::atomic<std::size_t> tracked::default_constructed{0};
+
+void test_first_touch( std::size_t n ) {
+    std::vector<int, tbb::numa_allocator<int>> zeros(n);
+    tbb::parallel_first_touch(zeros.data(), n, tbb::static_partitioner());
+    for (int x : zeros) {
+        CHECK(x == 0);
+    }
+
+    // The elements are constructed once, by the first touch only
+    using storage_allocator = tbb::numa_allocator<tracked>;
+    storage_allocator alloc;
+    tracked* data = alloc.allocate(n);
+    tracked::default_constructed = 0;
+    tbb::parallel_first_touch(data, tbb::blocked_range<std::size_t>(0, n, 16), tbb::static_partitioner(), 40, 2);
+    CHECK(tracked::default_constructed == 0);
+    for (std::size_t i = 0; i < n; ++i) {
+        CHECK(data[i].value == 42);
+        CHECK(data[i].thread >= 0);
+    }
+
+    tbb::affinity_partitioner ap;
+    tbb::parallel_first_touch(data, n, ap, 7);
+    for (std::size_t i = 0; i < n; ++i) {
+        CHECK(data[i].value == 7);
+    }
+    alloc.deallocate(data, n);
+}
+
+void test_all() {
+    for (std::size_t n : { 0, 1, 100, 100000 }) {
+        test_first_touch(n);
+    }
+}
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("numa_allocator meets the allocator requirements") {
+    using traits = std::allocator_traits<tbb::numa_allocator<int>>;
+    static_assert(std::is_same<traits::rebind_alloc<double>, tbb::numa_allocator<double>>::value, "Wrong rebind");
+    static_assert(traits::is_always_equal::value, "numa_allocator is stateless");
+    CHECK(tbb::numa_allocator<int>() == tbb::numa_allocator<double>());
+
+    // Construction without arguments default-initializes the elements
+    tracked::default_constructed = 0;
+    std::vector<tracked, tbb::numa_allocator<tracked>> v(10);
+    CHECK(tracked::default_constructed == 10);
+    std::vector<int, tbb::numa_allocator<int>> w(10, 5);
+    for (int x : w) {
+        CHECK(x == 5);
+    }
+    w.push_back(6);
+    CHECK(w.back() == 6);
+
+    // Every allocation takes whole pages of its own
+    tbb::numa_allocator<char> bytes;
+    for (std::size_t n : { 0, 1, 4096, 100000 }) {
+        char* p = bytes.allocate(n);
+        CHECK(reinterpret_cast<std::uintptr_t>(p) % 4096 == 0);
+        bytes.deallocate(p, n);
+    }
+}
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("parallel_first_touch constructs every element once") {
+    test_all();
+}
+
+//! \brief \ref requirement
+TEST_CASE("parallel_first_touch in a multi-threaded arena") {
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, 4);
+    tbb::task_arena arena(4);
+    arena.execute(test_all);
+}
+
+//! \brief \ref requirement
+TEST_CASE("parallel_first_touch over a set of arenas") {
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, 4);
+    std::vector<tbb::task_arena> arenas;
+    arenas.emplace_back(2);
+    arenas.emplace_back(3);
+    arenas.emplace_back(4);
+    for (std::size_t n : { 0, 2, 1000, 100001 }) {
+        tbb::numa_allocator<tracked> alloc;
+        tracked* data = alloc.allocate(n);
+        tbb::parallel_first_touch(data, n, arenas, 5);
+        std::size_t covered = 0;
+        for (std::size_t a = 0; a < arenas.size(); ++a) {
+            tbb::blocked_range<std::size_t> share = tbb::arena_share(n, a, arenas.size());
+            CHECK(share.begin() == covered);
+            covered = share.end();
+            for (std::size_t i = share.begin(); i != share.end(); ++i) {
+                CHECK(data[i].value == 5);
+                CHECK(data[i].arena_concurrency == int(a + 2));
+            }
+        }
+        CHECK(covered == n);
+        alloc.deallocate(data, n);
+    }
+}
+
+#if TBB_USE_EXCEPTIONS
+//! Throws on the construction with the given number
+struct throwing {
+    static std::atomic<int> constructions;
+    static std::atomic<int> live;
+
+    throwing( int fail_at ) {
+        if (constructions++ == fail_at) {
+            throw std::runtime_error("first touch");
+        }
+        ++live;
+    }
+    ~throwing() { --live; }
+};
+std::atomic<int> throwing::constructions{0};
+std::atomic<int> throwing::live{0};
+
+//! \brief \ref error_guessing
+TEST_CASE("parallel_first_touch destroys the constructed elements on exception") {
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, 4);
+    const std::size_t n = 10000;
+    tbb::numa_allocator<throwing> alloc;
+    throwing* data = alloc.allocate(n);
+    std::vector<tbb::task_arena> arenas(2);
+    for (int fail_at : { 0, 10, 7000 }) {
+        for (int variant = 0; variant < 2; ++variant) {
+            throwing::constructions = 0;
+            bool caught = false;
+            try {
+                if (variant == 0) {
+                    tbb::task_arena(4).execute([&] {
+                        tbb::parallel_first_touch(data, n, tbb::static_partitioner(), fail_at);
+                    });
+                } else {
+                    tbb::parallel_first_touch(data, n, arenas, fail_at);
+                }
+            } catch (const std::runtime_error&) {
+                caught = true;
+            }
+            CHECK(caught);
+            CHECK(throwing::live == 0);
+        }
+    }
+    alloc.deallocate(data, n);
+}
+#endif // TBB_USE_EXCEPTIONS
@@ -0,0 +1,155 @@
+/*
+    Copyright (c) 2025 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#define TBB_PREVIEW_PARALLEL_FOR_EACH_BATCHING 1
+
+#include "common/parallel_for_each_common.h"
+#include "oneapi/tbb/task_arena.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+//! \file test_parallel_for_each_batching.cpp
+//! \brief Test for [preview] functionality of batching in parallel_for_each
+
+//! Every item of the tree with the given fan-out and depth is added with add_range by its parent
+void test_feeder_add_range( std::size_t fan_out, std::size_t depth ) {
+    std::size_t expected = 0;
+    for (std::size_t level = 0, width = 1; level <= depth; ++level, width *= fan_out) {
+        expected += width;
+    }
+    std::atomic<std::size_t> visited{0};
+    std::vector<std::size_t> roots(1, 0);
+    tbb::parallel_for_each(roots.begin(), roots.end(), [&]( std::size_t level, tbb::feeder<std::size_t>& feeder ) {
+        ++visited;
+        if (level < depth) {
+            std::vector<std::size_t> children(fan_out, level + 1);
+            feeder.add_range(children.begin(), children.end());
+        }
+    });
+    CHECK(visited == expected);
+}
+
+//! Items added one by one and in ranges of different sizes must not be lost or duplicated
+void test_feeder_batches( std::size_t n ) {
+    std::vector<std::atomic<int>> visits(n);
+    for (auto& v : visits) {
+        v.store(0, std::memory_order_relaxed);
+    }
+    std::vector<std::size_t> roots(1, n);
+    tbb::parallel_for_each(roots.begin(), roots.end(), [&]( std::size_t item, tbb::feeder<std::size_t>& feeder ) {
+        if (item == n) {
+            std::size_t half = n / 2;
+            for (std::size_t i = 0; i < half; ++i) {
+                feeder.add(i);
+            }
+            std::vector<std::size_t> rest(n - half);
+            for (std::size_t i = half; i < n; ++i) {
+                rest[i - half] = i;
+            }
+            feeder.add_range(rest.begin(), rest.end());
+        } else {
+            ++visits[item];
+        }
+    });
+    for (auto& v : visits) {
+        CHECK(v.load(std::memory_order_relaxed) == 1);
+    }
+}
+
+//! Input iterators are fetched in blocks of varying size
+void test_input_blocks( std::size_t n ) {
+    std::vector<std::size_t> values(n);
+    std::vector<std::atomic<int>> visits(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        values[i] = i;
+        visits[i].store(0, std::memory_order_relaxed);
+    }
+    tbb::parallel_for_each(utils::InputIterator<std::size_t>(values.data()),
+                           utils::InputIterator<std::size_t>(values.data() + n),
+                           [&]( const std::size_t& i ) { ++visits[i]; });
+    for (auto& v : visits) {
+        CHECK(v.load(std::memory_order_relaxed) == 1);
+    }
+}
+
+void test_batching() {
+    test_feeder_add_range(1, 100);
+    test_feeder_add_range(3, 7);
+    test_feeder_add_range(1000, 1);
+    for (std::size_t n : { 1, 2, 255, 256, 257, 10000 }) {
+        test_feeder_batches(n);
+        test_input_blocks(n);
+    }
+}
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("parallel_for_each batches fed items and input blocks") {
+    test_batching();
+}
+
+//! \brief \ref requirement
+TEST_CASE("parallel_for_each batching in a multi-threaded arena") {
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, 4);
+    tbb::task_arena arena(4);
+    arena.execute(test_batching);
+}
+
+//! \brief \ref interface
+TEST_CASE("feeder::add_range with move-only items") {
+    std::vector<std::unique_ptr<int>> roots;
+    roots.emplace_back(new int(10));
+    roots.emplace_back(new int(20));
+    std::atomic<int> sum{0};
+    tbb::parallel_for_each(std::make_move_iterator(roots.begin()), std::make_move_iterator(roots.end()), [&]( std::unique_ptr<int> item, tbb::feeder<std::unique_ptr<int>>& feeder ) {
+        if (*item >= 10) {
+            std::vector<std::unique_ptr<int>> children;
+            for (int i = 0; i < *item / 10 + 2; ++i) {
+                children.emplace_back(new int(1));
+            }
+            feeder.add_range(std::make_move_iterator(children.begin()), std::make_move_iterator(children.end()));
+        }
+        sum += *item;
+    });
+    CHECK(sum == 10 + 20 + 3 + 4);
+}
+
+//! \brief \ref requirement
+TEST_CASE("feeder::add spawns the item before the body returns") {
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, 4);
+    tbb::task_arena arena(4);
+    arena.execute([] {
+        std::atomic<bool> fed_item_started{false};
+        std::vector<int> roots(1, 0);
+        tbb::parallel_for_each(roots.begin(), roots.end(), [&]( int item, tbb::feeder<int>& feeder ) {
+            if (item == 0) {
+                feeder.add(1);
+                // Another thread takes the fed item while this call of the body is running;
+                // the deadline only prevents a hang if the item is held back
+                auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+                while (!fed_item_started && std::chrono::steady_clock::now() < deadline) {
+                    std::this_thread::yield();
+                }
+                CHECK(fed_item_started);
+            } else {
+                fed_item_started = true;
+            }
+        });
+    });
+}
@@ -0,0 +1,144 @@
+/*
+    Copyright (c) 2025 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#define TBB_PREVIEW_PARALLEL_LOOP_PLAN 1
+
+#include "common/test.h"
+#include "common/utils.h"
+
+#include "tbb/parallel_loop_plan.h"
+#include "tbb/parallel_for.h"
+#include "tbb/blocked_range.h"
+#include "tbb/global_control.h"
+#include "tbb/task_arena.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+//! \file test_parallel_loop_plan.cpp
+//! \brief Test for [preview] functionality of parallel_loop_plan
+
+using range_type = tbb::blocked_range<std::size_t>;
+
+//! Checks that every iteration visits every element once and only after the previous iteration completes
+void test_iterations( std::size_t n, std::size_t num_chunks, std::size_t num_iterations ) {
+    tbb::parallel_loop_plan<range_type> plan(range_type(0, n), num_chunks);
+    REQUIRE(plan.num_participants() <= plan.num_chunks());
+    std::vector<std::atomic<std::size_t>> visits(n);
+    for (int run = 0; run < 2; ++run) {
+        for (auto& v : visits) {
+            v.store(0, std::memory_order_relaxed);
+        }
+        std::atomic<bool> ordered{true};
+        std::size_t epochs = 0;
+        plan.run(num_iterations, [&]( const range_type& r, std::size_t iteration ) {
+            for (std::size_t i = r.begin(); i != r.end(); ++i) {
+                if (visits[i].fetch_add(1, std::memory_order_relaxed) != iteration) {
+                    ordered = false;
+                }
+                // The neighbours may belong to other chunks, which are done with the previous iteration
+                if (i > 0 && visits[i - 1].load(std::memory_order_relaxed) < iteration) {
+                    ordered = false;
+                }
+            }
+        }, [&]( std::size_t iteration ) {
+            CHECK(epochs == iteration);
+            ++epochs;
+            for (auto& v : visits) {
+                CHECK(v.load(std::memory_order_relaxed) == iteration + 1);
+            }
+        });
+        CHECK(ordered);
+        CHECK(epochs == (n == 0 ? 0 : num_iterations));
+        for (auto& v : visits) {
+            CHECK(v.load(std::memory_order_relaxed) == num_iterations);
+        }
+    }
+}
+
+void test_all() {
+    for (std::size_t n : { 0, 1, 10, 1000 }) {
+        for (std::size_t num_chunks : { 1, 3, 16, 100 }) {
+            test_iterations(n, num_chunks, 20);
+        }
+    }
+}
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("parallel_loop_plan executes each iteration once over the whole range") {
+    test_all();
+    tbb::parallel_loop_plan<range_type> plan(range_type(0, 100, 10));
+    CHECK(plan.num_chunks() <= 10);
+    std::atomic<std::size_t> total{0};
+    plan.run(5, [&]( const range_type& r, std::size_t ) { total += r.size(); });
+    CHECK(total == 500);
+}
+
+//! \brief \ref requirement
+TEST_CASE("parallel_loop_plan in a multi-threaded arena") {
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, 4);
+    tbb::task_arena arena(4);
+    arena.execute(test_all);
+}
+
+//! \brief \ref error_guessing
+TEST_CASE("parallel_loop_plan with nested parallelism") {
+    // A thread waiting in a nested loop must not take a participant that waits for the epoch
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, 4);
+    tbb::task_arena arena(4);
+    arena.execute([] {
+        tbb::parallel_loop_plan<range_type> plan(range_type(0, 64), 16);
+        std::atomic<std::size_t> total{0};
+        plan.run(10, [&]( const range_type& r, std::size_t ) {
+            tbb::parallel_for(range_type(0, 100, 1), [&]( const range_type& inner ) {
+                total += r.size() * inner.size();
+            });
+        });
+        CHECK(total == 64 * 100 * 10);
+    });
+}
+
+#if TBB_USE_EXCEPTIONS
+//! \brief \ref error_guessing
+TEST_CASE("parallel_loop_plan propagates exceptions") {
+    // Waiting for the epoch must stop when the loop is cancelled
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, 4);
+    for (int concurrency_level : { 1, 2, 4 }) {
+        tbb::task_arena arena(concurrency_level);
+        arena.execute([] {
+            tbb::parallel_loop_plan<range_type> plan(range_type(0, 1000), 32);
+            bool caught = false;
+            try {
+                plan.run(100, []( const range_type& r, std::size_t iteration ) {
+                    if (iteration == 7 && r.begin() <= 500 && 500 < r.end()) {
+                        throw std::runtime_error("loop plan");
+                    }
+                });
+            } catch (const std::runtime_error& e) {
+                caught = std::string(e.what()) == "loop plan";
+            }
+            CHECK(caught);
+
+            // The plan can be run again after the exception
+            std::atomic<std::size_t> total{0};
+            plan.run(3, [&]( const range_type& r, std::size_t ) { total += r.size(); });
+            CHECK(total == 3000);
+        });
+    }
+}
+#endif // TBB_USE_EXCEPTIONS
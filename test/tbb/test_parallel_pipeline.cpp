@@ -14,6 +14,11 @@
     limitations under the License.
 */
 
+#define TBB_PREVIEW_PIPELINE_BATCHING 1
+#define TBB_PREVIEW_PIPELINE_LIMITS 1
+#define TBB_PREVIEW_PIPELINE_OBJECT_POOL 1
+#define TBB_PREVIEW_PIPELINE_BRANCHES 1
+
 // Before including parallel_pipeline.h, set up the variable to count heap allocated
 // filter_node objects, and make it known for the header.
 #include "common/test.h"
@@ -26,10 +31,21 @@ int filter_node_count = 0;
 #include "tbb/global_control.h"
 #include "tbb/spin_mutex.h"
 #include "tbb/task_group.h"
+#include "tbb/task_arena.h"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <string.h>
+#include <string>
 #include <memory> // std::unique_ptr
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 //! \file test_parallel_pipeline.cpp
 //! \brief Test for [algorithms.parallel_pipeline algorithms.parallel_pipeline.flow_control] specification
@@ -680,3 +696,410 @@ RUN_TYPED_TEST_CASE(double, CheckType<unsigned short>)
 RUN_TYPED_TEST_CASE(std::unique_ptr<int>, std::unique_ptr<int>) // move-only type
 
 #undef RUN_TYPED_TEST_CASE
+
+//! Items pass through parallel batch filters and come out of a serial one in the input order
+void test_batch_filters( std::size_t n, std::size_t max_batch_size ) {
+    std::size_t next_input = 0;
+    std::size_t next_output = 0;
+    bool ordered = true;
+    tbb::parallel_pipeline(n_tokens,
+        tbb::make_batch_filter<void, std::size_t>(tbb::filter_mode::serial_in_order,
+            [&]( tbb::flow_control& fc ) -> std::size_t {
+                if (next_input == n) {
+                    fc.stop();
+                    return 0;
+                }
+                return next_input++;
+            }, max_batch_size) &
+        tbb::make_batch_filter<std::size_t, std::unique_ptr<std::size_t>>(tbb::filter_mode::parallel,
+            []( std::size_t i ) { return std::unique_ptr<std::size_t>(new std::size_t(2 * i)); }) &
+        tbb::make_filter<tbb::pipeline_batch<std::unique_ptr<std::size_t>>, tbb::pipeline_batch<std::unique_ptr<std::size_t>>>(
+            tbb::filter_mode::parallel,
+            [&]( tbb::pipeline_batch<std::unique_ptr<std::size_t>> batch ) {
+                // Stages can also work with the whole batch
+                CHECK(batch.size() >= 1);
+                CHECK(batch.size() <= max_batch_size);
+                return batch;
+            }) &
+        tbb::make_batch_filter(tbb::filter_mode::serial_in_order,
+            [&]( std::unique_ptr<std::size_t> p ) {
+                if (*p != 2 * next_output) {
+                    ordered = false;
+                }
+                ++next_output;
+            }));
+    CHECK(ordered);
+    CHECK(next_input == n);
+    CHECK(next_output == n);
+}
+
+void test_batch_filters_all() {
+    for (std::size_t n : { 0, 1, 5, 100000 }) {
+        for (std::size_t max_batch_size : { 1, 7, 1024 }) {
+            test_batch_filters(n, max_batch_size);
+        }
+    }
+}
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("Batch filters keep the order of items") {
+    test_batch_filters_all();
+    tbb::global_control control(tbb::global_control::max_allowed_parallelism, 4);
+    tbb::task_arena arena(4);
+    arena.execute(test_batch_filters_all);
+    CHECK_MESSAGE(!filter_node_count, "filter_node objects leaked");
+}
+
+//! \brief \ref requirement
+TEST_CASE("Batch size adapts to the cost of items") {
+    auto run = [&]( std::chrono::microseconds item_time ) {
+        std::size_t next_input = 0;
+        std::size_t last_batch_size = 0;
+        std::size_t max_batch_size = 0;
+        tbb::parallel_pipeline(n_tokens,
+            tbb::make_batch_filter<void, int>(tbb::filter_mode::serial_in_order,
+                [&]( tbb::flow_control& fc ) {
+                    if (next_input == 2000) {
+                        fc.stop();
+                    }
+                    return int(next_input++);
+                }, 256) &
+            tbb::make_batch_filter<int, int>(tbb::filter_mode::parallel, [&]( int x ) {
+                auto start = std::chrono::steady_clock::now();
+                while (std::chrono::steady_clock::now() - start < item_time) {}
+                return x;
+            }) &
+            tbb::make_filter<tbb::pipeline_batch<int>, void>(tbb::filter_mode::serial_in_order,
+                [&]( tbb::pipeline_batch<int> batch ) {
+                    last_batch_size = batch.size();
+                    max_batch_size = std::max(max_batch_size, batch.size());
+                }));
+        return std::make_pair(last_batch_size, max_batch_size);
+    };
+    // Items that take longer than the target work per token are passed one at a time
+    CHECK(run(std::chrono::microseconds(100)).first == 1);
+    // Cheap items fill the batches
+    CHECK(run(std::chrono::microseconds(0)).second > 16);
+}
+
+void spin_for( std::chrono::microseconds duration ) {
+    auto start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < duration) {}
+}
+
+//! Checks that the number of items in flight grows up to the token limit and the items stay in order
+void test_adaptive_tokens( const tbb::pipeline_limits& limits, std::size_t n, bool multithreaded ) {
+    std::size_t next_input = 0;
+    std::size_t next_output = 0;
+    std::atomic<std::size_t> live{0};
+    std::atomic<std::size_t> max_live{0};
+    bool ordered = true;
+    bool wait_for_all_tokens = multithreaded && n > limits.max_tokens();
+    tbb::parallel_pipeline(limits,
+        tbb::make_filter<void, std::size_t>(tbb::filter_mode::serial_in_order,
+            [&]( tbb::flow_control& fc ) -> std::size_t {
+                if (next_input == n) {
+                    fc.stop();
+                    return 0;
+                }
+                std::size_t l = ++live;
+                for (std::size_t m = max_live; m < l && !max_live.compare_exchange_weak(m, l); ) {}
+                return next_input++;
+            }) &
+        tbb::make_filter<std::size_t, std::size_t>(tbb::filter_mode::parallel, [&]( std::size_t i ) {
+            if (i == 0 && wait_for_all_tokens) {
+                // The other items wait for this one in the output filter and take all the tokens
+                auto start = std::chrono::steady_clock::now();
+                while (live < limits.max_tokens() && std::chrono::steady_clock::now() - start < std::chrono::seconds(10)) {
+                    std::this_thread::yield();
+                }
+            }
+            spin_for(std::chrono::microseconds(5));
+            return i;
+        }) &
+        tbb::make_filter<std::size_t, void>(tbb::filter_mode::serial_in_order, [&]( std::size_t i ) {
+            if (i != next_output++) {
+                ordered = false;
+            }
+            --live;
+        }));
+    CHECK(ordered);
+    CHECK(next_output == n);
+    CHECK(max_live <= limits.max_tokens());
+    if (wait_for_all_tokens) {
+        CHECK(max_live == limits.max_tokens());
+    }
+}
+
+//! Checks that the input stops while the items in flight take more than the byte limit
+template <typename T, typename SizeOf, typename MakeItem>
+void test_byte_limit( std::size_t max_bytes, SizeOf size_of, MakeItem make_item, bool multithreaded ) {
+    const std::size_t n = 2000;
+    const std::size_t max_item_size = 300;
+    std::size_t next_input = 0;
+    std::size_t next_output = 0;
+    std::atomic<std::size_t> bytes{0};
+    std::atomic<std::size_t> max_bytes_seen{0};
+    std::atomic<bool> first{true};
+    tbb::parallel_pipeline(tbb::pipeline_limits(4, 64).limit_bytes<T>(max_bytes, size_of),
+        tbb::make_filter<void, T>(tbb::filter_mode::serial_in_order,
+            [&]( tbb::flow_control& fc ) {
+                if (next_input == n) {
+                    fc.stop();
+                    return make_item(0);
+                }
+                std::size_t size = next_input++ * 7919 % max_item_size + 1;
+                std::size_t b = bytes += size;
+                for (std::size_t m = max_bytes_seen; m < b && !max_bytes_seen.compare_exchange_weak(m, b); ) {}
+                return make_item(size);
+            }) &
+        tbb::make_filter<T, T>(tbb::filter_mode::parallel, [&]( T item ) {
+            if (multithreaded && first.exchange(false)) {
+                // The next items wait for this one in the output filter until the input stops
+                auto start = std::chrono::steady_clock::now();
+                while (bytes < max_bytes && std::chrono::steady_clock::now() - start < std::chrono::seconds(10)) {
+                    std::this_thread::yield();
+                }
+            }
+            spin_for(std::chrono::microseconds(5));
+            return item;
+        }) &
+        tbb::make_filter<T, void>(tbb::filter_mode::serial_in_order, [&]( const T& item ) {
+            bytes -= size_of(item);
+            ++next_output;
+        }));
+    CHECK(next_output == n);
+    CHECK(bytes == 0);
+    // The item that exceeds the limit is let in, the next one waits
+    CHECK(max_bytes_seen < max_bytes + max_item_size);
+    if (multithreaded) {
+        CHECK(max_bytes_seen >= max_bytes);
+    }
+}
+
+void test_pipeline_limits_all( bool multithreaded ) {
+    for (std::size_t n : { 0, 1, 5, 10000 }) {
+        test_adaptive_tokens(tbb::pipeline_limits(1, 8), n, multithreaded);
+        test_adaptive_tokens(tbb::pipeline_limits(4, 4), n, multithreaded);
+        test_adaptive_tokens(tbb::pipeline_limits(32), n, multithreaded);
+    }
+    test_byte_limit<std::size_t>(1000, []( const std::size_t& size ) { return size; },
+                                 []( std::size_t size ) { return size; }, multithreaded);
+    test_byte_limit<std::string>(1000, []( const std::string& s ) { return s.size(); },
+                                 []( std::size_t size ) { return std::string(size, 'x'); }, multithreaded);
+    // An item larger than the limit passes alone
+    test_byte_limit<std::string>(1, []( const std::string& s ) { return s.size(); },
+                                 []( std::size_t size ) { return std::string(size, 'x'); }, multithreaded);
+    // A size function with captures
+    const std::size_t header_size = 16;
+    test_byte_limit<std::string>(1000, [header_size]( const std::string& s ) { return s.size() - header_size; },
+                                 [header_size]( std::size_t size ) { return std::string(size + header_size, 'x'); },
+                                 multithreaded);
+}
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("Adaptive number of tokens and byte limit of parallel_pipeline") {
+    test_pipeline_limits_all(false);
+    tbb::global_control control(tbb::global_control::max_allowed_parallelism, 4);
+    tbb::task_arena arena(4);
+    arena.execute([] { test_pipeline_limits_all(true); });
+    CHECK_MESSAGE(!filter_node_count, "filter_node objects leaked");
+}
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("pipeline_object_pool recycles buffers") {
+    auto run = [] {
+        const std::size_t n = 10000;
+        std::size_t next_input = 0;
+        std::size_t total = 0;
+        std::set<const char*> buffer_data;
+        using pool_type = tbb::pipeline_object_pool<std::vector<char>>;
+        pool_type pool;
+        tbb::parallel_pipeline(n_tokens,
+            tbb::make_filter<void, pool_type::handle>(tbb::filter_mode::serial_in_order,
+                [&]( tbb::flow_control& fc ) {
+                    if (next_input == n) {
+                        fc.stop();
+                        return pool_type::handle();
+                    }
+                    pool_type::handle buffer = pool.acquire();
+                    buffer->assign(1000, 'x');
+                    ++next_input;
+                    return buffer;
+                }) &
+            tbb::make_filter<pool_type::handle, pool_type::handle>(tbb::filter_mode::parallel,
+                []( pool_type::handle buffer ) {
+                    std::fill(buffer->begin(), buffer->end(), 'y');
+                    return buffer;
+                }) &
+            tbb::make_filter<pool_type::handle, void>(tbb::filter_mode::serial_in_order,
+                [&]( pool_type::handle buffer ) {
+                    buffer_data.insert(buffer->data());
+                    total += std::count(buffer->begin(), buffer->end(), 'y');
+                }));
+        CHECK(total == 1000 * n);
+        CHECK(pool.size() <= n_tokens);
+        // The buffers keep their memory between the tokens
+        CHECK(buffer_data.size() <= pool.size());
+
+        pool_type::handle h = pool.acquire();
+        CHECK(h);
+        CHECK(h->capacity() >= 1000);
+        h.reset();
+        CHECK(!h);
+        CHECK(h.get() == nullptr);
+    };
+    run();
+    tbb::global_control control(tbb::global_control::max_allowed_parallelism, 4);
+    tbb::task_arena arena(4);
+    arena.execute(run);
+}
+
+struct alignas(64) aligned_block {
+    std::size_t value;
+};
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("pipeline_object_pool handles taken by a parallel input filter and limited in bytes") {
+    auto run = [] {
+        const std::size_t n = 10000;
+        std::atomic<std::size_t> next_input{0};
+        std::atomic<std::size_t> total{0};
+        std::atomic<bool> intact{true};
+        using pool_type = tbb::pipeline_object_pool<aligned_block>;
+        pool_type pool;
+        // The size function sees the handle in flight; it must not give the object back to the pool
+        tbb::parallel_pipeline(tbb::pipeline_limits(4, 16).limit_bytes<pool_type::handle>(8 * sizeof(aligned_block),
+                []( const pool_type::handle& block ) { return sizeof(*block); }),
+            tbb::make_filter<void, pool_type::handle>(tbb::filter_mode::parallel,
+                [&]( tbb::flow_control& fc ) {
+                    std::size_t i = next_input++;
+                    if (i >= n) {
+                        fc.stop();
+                        return pool_type::handle();
+                    }
+                    pool_type::handle block = pool.acquire();
+                    if (reinterpret_cast<std::uintptr_t>(block.get()) % alignof(aligned_block) != 0) {
+                        intact = false;
+                    }
+                    block->value = i;
+                    return block;
+                }) &
+            tbb::make_filter<pool_type::handle, pool_type::handle>(tbb::filter_mode::parallel,
+                []( pool_type::handle block ) {
+                    spin_for(std::chrono::microseconds(5));
+                    return block;
+                }) &
+            tbb::make_filter<pool_type::handle, void>(tbb::filter_mode::parallel,
+                [&]( pool_type::handle block ) {
+                    // Another token that reused the object too early would have overwritten the value
+                    if (block->value >= n) {
+                        intact = false;
+                    }
+                    total += block->value;
+                    block->value = n;
+                }));
+        CHECK(intact);
+        CHECK(total == n * (n - 1) / 2);
+        CHECK(pool.size() > 0);
+    };
+    run();
+    tbb::global_control control(tbb::global_control::max_allowed_parallelism, 4);
+    tbb::task_arena arena(4);
+    arena.execute(run);
+}
+
+//! Checks that the results of all the branches of an item reach the merge filter together and in order
+void test_split_merge( std::size_t n ) {
+    std::size_t next_input = 0;
+    std::size_t next_output = 0;
+    std::atomic<std::size_t> side_effects{0};
+    bool ordered = true;
+    using results_type = std::tuple<std::size_t, std::string, std::unique_ptr<std::size_t>, std::nullptr_t>;
+    tbb::parallel_pipeline(n_tokens,
+        tbb::make_filter<void, std::size_t>(tbb::filter_mode::serial_in_order,
+            [&]( tbb::flow_control& fc ) -> std::size_t {
+                if (next_input == n) {
+                    fc.stop();
+                    return 0;
+                }
+                return next_input++;
+            }) &
+        tbb::make_split_filter<std::size_t>(tbb::filter_mode::parallel,
+            []( std::size_t i ) { return i * i; },
+            []( std::size_t i ) { return std::to_string(i); },
+            []( std::size_t i ) { return std::unique_ptr<std::size_t>(new std::size_t(i + 1)); },
+            [&]( std::size_t ) { ++side_effects; }) &
+        tbb::make_merge_filter<results_type, void>(tbb::filter_mode::serial_in_order,
+            [&]( std::size_t square, std::string text, std::unique_ptr<std::size_t> next, std::nullptr_t ) {
+                std::size_t i = next_output++;
+                if (square != i * i || text != std::to_string(i) || *next != i + 1) {
+                    ordered = false;
+                }
+            }));
+    CHECK(ordered);
+    CHECK(next_output == n);
+    CHECK(side_effects == n);
+}
+
+void test_split_merge_all() {
+    for (std::size_t n : { 0, 1, 5, 2000 }) {
+        test_split_merge(n);
+    }
+    // A merge filter in the middle of the pipeline and a single branch
+    std::size_t next_input = 0;
+    std::size_t sum = 0;
+    tbb::parallel_pipeline(n_tokens,
+        tbb::make_filter<void, int>(tbb::filter_mode::serial_in_order,
+            [&]( tbb::flow_control& fc ) {
+                if (next_input == 100) {
+                    fc.stop();
+                }
+                return int(next_input++);
+            }) &
+        tbb::make_split_filter<int>(tbb::filter_mode::serial_out_of_order, []( int i ) { return i; }) &
+        tbb::make_merge_filter<std::tuple<int>, int>(tbb::filter_mode::parallel, []( int i ) { return 2 * i; }) &
+        tbb::make_filter<int, void>(tbb::filter_mode::serial_out_of_order, [&]( int i ) { sum += i; }));
+    CHECK(sum == 99 * 100);
+}
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("Split and merge filters") {
+    test_split_merge_all();
+    tbb::global_control control(tbb::global_control::max_allowed_parallelism, 4);
+    tbb::task_arena arena(4);
+    arena.execute(test_split_merge_all);
+    CHECK_MESSAGE(!filter_node_count, "filter_node objects leaked");
+}
+
+#if TBB_USE_EXCEPTIONS
+//! \brief \ref error_guessing
+TEST_CASE("Exception in a branch of a split filter") {
+    std::size_t next_input = 0;
+    bool caught = false;
+    try {
+        tbb::parallel_pipeline(n_tokens,
+            tbb::make_filter<void, int>(tbb::filter_mode::serial_in_order,
+                [&]( tbb::flow_control& fc ) {
+                    if (next_input == 1000) {
+                        fc.stop();
+                    }
+                    return int(next_input++);
+                }) &
+            tbb::make_split_filter<int>(tbb::filter_mode::parallel,
+                []( int i ) { return std::string(std::size_t(i % 7), 'x'); },
+                []( int i ) {
+                    if (i == 500) {
+                        throw std::runtime_error("branch");
+                    }
+                    return i;
+                }) &
+            tbb::make_merge_filter<std::tuple<std::string, int>, void>(tbb::filter_mode::serial_in_order,
+                []( std::string, int ) {}));
+    } catch (const std::runtime_error& e) {
+        caught = std::string(e.what()) == "branch";
+    }
+    CHECK(caught);
+    CHECK_MESSAGE(!filter_node_count, "filter_node objects leaked");
+}
+#endif // TBB_USE_EXCEPTIONS
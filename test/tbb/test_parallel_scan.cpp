@@ -18,6 +18,8 @@
 #pragma warning(disable : 2586) // decorated name length exceeded, name was truncated
 #endif
 
+#define TBB_PREVIEW_PARALLEL_SCAN_SINGLE_PASS 1
+
 #include "common/test.h"
 #include "common/config.h"
 #include "common/utils_concurrency_limit.h"
@@ -27,9 +29,13 @@
 #include "tbb/global_control.h"
 #include "tbb/parallel_scan.h"
 #include "tbb/blocked_range.h"
+#include "tbb/task_arena.h"
+#include "tbb/task_group.h"
 #include "tbb/tick_count.h"
 #include <vector>
 #include <atomic>
+#include <stdexcept>
+#include <string>
 
 //! \file test_parallel_scan.cpp
 //! \brief Test for [algorithms.parallel_scan] specification
@@ -572,3 +578,168 @@ TEST_CASE("parallel_scan constraints") {
     test_pscan_combine_constraints();
 }
 #endif // __TBB_CPP20_CONCEPTS_PRESENT
+
+//! Element of a prefix composition of affine maps x -> a*x + b, which is not commutative
+struct AffineMap {
+    unsigned a;
+    unsigned b;
+
+    friend AffineMap operator*( const AffineMap& left, const AffineMap& right ) {
+        // Apply left first, then right
+        return AffineMap{right.a * left.a, right.a * left.b + right.b};
+    }
+    friend bool operator==( const AffineMap& x, const AffineMap& y ) {
+        return x.a == y.a && x.b == y.b;
+    }
+};
+
+class AffineScanBody {
+    const std::vector<AffineMap>& my_input;
+    std::vector<AffineMap>& my_output;
+    AffineMap my_sum;
+public:
+    AffineScanBody( const std::vector<AffineMap>& input, std::vector<AffineMap>& output, AffineMap init ) :
+        my_input(input), my_output(output), my_sum(init) {}
+    AffineScanBody( AffineScanBody& b, tbb::split ) :
+        my_input(b.my_input), my_output(b.my_output), my_sum{1, 0} {}
+    template<typename Tag>
+    void operator()( const Range& r, Tag ) {
+        AffineMap sum = my_sum;
+        for( long i = r.begin(); i < r.end(); ++i ) {
+            sum = sum * my_input[i];
+            if( Tag::is_final_scan() )
+                my_output[i] = sum;
+        }
+        my_sum = sum;
+    }
+    void reverse_join( AffineScanBody& left ) { my_sum = left.my_sum * my_sum; }
+    void assign( AffineScanBody& b ) { my_sum = b.my_sum; }
+    AffineMap sum() const { return my_sum; }
+};
+
+std::vector<AffineMap> MakeAffineInput( long n ) {
+    std::vector<AffineMap> input(n);
+    for( long i = 0; i < n; ++i )
+        input[i] = AffineMap{unsigned(2 * i + 3), unsigned(i * i + 1)};
+    return input;
+}
+
+void TestSinglePassScan( long n, long grainsize ) {
+    const AffineMap init{5, 7};
+    std::vector<AffineMap> input = MakeAffineInput(n);
+    std::vector<AffineMap> expected(n);
+    AffineMap total = init;
+    for( long i = 0; i < n; ++i ) {
+        total = total * input[i];
+        expected[i] = total;
+    }
+
+    std::vector<AffineMap> output(n, AffineMap{0, 0});
+    AffineScanBody body(input, output, init);
+    tbb::parallel_scan(Range(0, n, grainsize), body, tbb::single_pass_partitioner());
+    CHECK_MESSAGE(body.sum() == total, "Incorrect total for n = " << n << ", grainsize = " << grainsize);
+    CHECK_MESSAGE(output == expected, "Incorrect prefix for n = " << n << ", grainsize = " << grainsize);
+
+    // The functional form starts from the identity element
+    const AffineMap identity{1, 0};
+    AffineMap lambda_expected_total = identity;
+    for( long i = 0; i < n; ++i ) {
+        lambda_expected_total = lambda_expected_total * input[i];
+        expected[i] = lambda_expected_total;
+    }
+    std::vector<AffineMap> lambda_output(n, AffineMap{0, 0});
+    AffineMap lambda_total = tbb::parallel_scan(Range(0, n, grainsize), identity,
+        [&]( const Range& r, AffineMap sum, bool is_final_scan ) {
+            for( long i = r.begin(); i < r.end(); ++i ) {
+                sum = sum * input[i];
+                if( is_final_scan )
+                    lambda_output[i] = sum;
+            }
+            return sum;
+        },
+        []( const AffineMap& left, const AffineMap& right ) { return left * right; },
+        tbb::single_pass_partitioner());
+    CHECK_MESSAGE(lambda_total == lambda_expected_total, "Incorrect total for n = " << n << ", grainsize = " << grainsize);
+    CHECK_MESSAGE(lambda_output == expected, "Incorrect prefix for n = " << n << ", grainsize = " << grainsize);
+}
+
+//! \brief \ref requirement \ref interface
+TEST_CASE("parallel_scan with single_pass_partitioner") {
+    for (auto concurrency_level : utils::concurrency_range()) {
+        tbb::global_control control(tbb::global_control::max_allowed_parallelism, concurrency_level);
+        for( long n : {0L, 1L, 2L, 17L, 1000L, 100000L} ) {
+            for( long grainsize : {1L, 7L, 1000L} ) {
+                TestSinglePassScan(n, grainsize);
+            }
+        }
+    }
+    // Chunks are processed concurrently and in any order also when the machine is oversubscribed
+    tbb::global_control control(tbb::global_control::max_allowed_parallelism, 4);
+    tbb::task_arena arena(4);
+    arena.execute([] {
+        for( int i = 0; i < 10; ++i ) {
+            TestSinglePassScan(100000, 10);
+        }
+    });
+}
+
+//! Cancels the task group on the first call and checks that only constructed bodies are assigned
+class CancellingScanBody {
+    static constexpr int constructed = 0x5ca9;
+    int my_magic;
+    tbb::task_group& my_group;
+public:
+    CancellingScanBody( tbb::task_group& group ) : my_magic(constructed), my_group(group) {}
+    CancellingScanBody( CancellingScanBody& b, tbb::split ) : my_magic(constructed), my_group(b.my_group) {}
+    ~CancellingScanBody() { my_magic = 0; }
+    template<typename Tag>
+    void operator()( const Range&, Tag ) { my_group.cancel(); }
+    void reverse_join( CancellingScanBody& ) {}
+    void assign( CancellingScanBody& b ) { CHECK(b.my_magic == constructed); }
+};
+
+//! \brief \ref error_guessing
+TEST_CASE("parallel_scan with single_pass_partitioner is cancelled by the outer context") {
+    tbb::global_control control(tbb::global_control::max_allowed_parallelism, 4);
+    tbb::task_arena arena(4);
+    arena.execute([] {
+        for( int i = 0; i < 100; ++i ) {
+            tbb::task_group group;
+            CancellingScanBody body(group);
+            // The first chunk is being scanned when the group is cancelled,
+            // so the chunks that follow it are never completed
+            tbb::task_group_status status = group.run_and_wait([&] {
+                tbb::parallel_scan(Range(0, 100000, 100), body, tbb::single_pass_partitioner());
+            });
+            CHECK(status == tbb::canceled);
+        }
+    });
+}
+
+#if TBB_USE_EXCEPTIONS
+//! \brief \ref error_guessing
+TEST_CASE("parallel_scan with single_pass_partitioner propagates exceptions") {
+    // Waiting for the predecessors of a chunk must stop when the scan is cancelled
+    tbb::global_control control(tbb::global_control::max_allowed_parallelism, 4);
+    for( int concurrency_level : {1, 2, 4} ) {
+        tbb::task_arena arena(concurrency_level);
+        arena.execute([] {
+            const long n = 100000;
+            bool caught = false;
+            try {
+                tbb::parallel_scan(Range(0, n, 100), 0L,
+                    [&]( const Range& r, long sum, bool ) {
+                        if( r.begin() <= n / 2 && n / 2 < r.end() )
+                            throw std::runtime_error("single pass");
+                        return sum + long(r.size());
+                    },
+                    []( long left, long right ) { return left + right; },
+                    tbb::single_pass_partitioner());
+            } catch( const std::runtime_error& e ) {
+                caught = std::string(e.what()) == "single pass";
+            }
+            CHECK(caught);
+        });
+    }
+}
+#endif // TBB_USE_EXCEPTIONS
@@ -14,9 +14,14 @@
     limitations under the License.
 */
 
+#define TBB_PREVIEW_TUNING_PARTITIONER 1
+#define TBB_PREVIEW_PREALLOCATED_TASK_TREE 1
+#define TBB_PREVIEW_BANDWIDTH_PARTITIONER 1
+
 #include "common/test.h"
 
 #include "tbb/parallel_for.h"
+#include "tbb/parallel_reduce.h"
 #include "tbb/task_arena.h"
 #include "tbb/task_scheduler_observer.h"
 #include "tbb/global_control.h"
@@ -30,7 +35,10 @@
 #include <cstddef>
 #include <utility>
 #include <vector>
-#include <algorithm> // std::min_element
+#include <algorithm> // std::min_element, std::sort, std::adjacent_find
+#include <chrono>
+#include <stdexcept>
+#include <string>
 
 //! \file test_partitioner.cpp
 //! \brief Test for [internal] functionality
@@ -227,3 +235,269 @@ TEST_CASE("Test partitioned tasks count and size for static_partitioner") {
 
     test_custom_range<custom_range_with_psplit>(1);
 }
+
+namespace preallocated_task_tree_tests {
+
+//! Concatenates the indices, so the result depends on the order of joins
+struct concatenating_body {
+    std::string my_result;
+
+    concatenating_body() = default;
+    concatenating_body(concatenating_body&, tbb::split) {}
+
+    void operator()(const tbb::blocked_range<int>& r) {
+        for (int i = r.begin(); i != r.end(); ++i) {
+            my_result += std::to_string(i) + ",";
+        }
+    }
+    void join(concatenating_body& rhs) { my_result += rhs.my_result; }
+};
+
+//! Records the address of the body that processes each leaf
+struct leaf_body {
+    std::vector<const leaf_body*>& my_bodies;
+    tbb::mutex& my_mutex;
+
+    void operator()(const tbb::blocked_range<int>&) const {
+        tbb::mutex::scoped_lock lock(my_mutex);
+        my_bodies.push_back(this);
+    }
+};
+
+void test_static_trees() {
+    std::size_t max_leaves = std::size_t(tbb::this_task_arena::max_concurrency());
+    for (int n : { 1, 2, 3, 10, 1000 }) {
+        std::vector<std::atomic<int>> visits(n);
+        std::atomic<std::size_t> leaves{0};
+        tbb::parallel_for(tbb::blocked_range<int>(0, n), [&](const tbb::blocked_range<int>& r) {
+            ++leaves;
+            for (int i = r.begin(); i != r.end(); ++i) {
+                ++visits[i];
+            }
+        }, tbb::static_partitioner());
+        for (auto& v : visits) {
+            REQUIRE(v == 1);
+        }
+        REQUIRE(leaves == std::min(std::size_t(n), max_leaves));
+
+        // The leaves do not share the body, which may keep mutable scratch data
+        std::vector<const leaf_body*> bodies;
+        tbb::mutex mutex;
+        tbb::parallel_for(tbb::blocked_range<int>(0, n), leaf_body{bodies, mutex}, tbb::static_partitioner());
+        std::sort(bodies.begin(), bodies.end());
+        REQUIRE(std::adjacent_find(bodies.begin(), bodies.end()) == bodies.end());
+
+        concatenating_body body;
+        tbb::parallel_reduce(tbb::blocked_range<int>(0, n), body, tbb::static_partitioner());
+        std::string expected;
+        for (int i = 0; i < n; ++i) {
+            expected += std::to_string(i) + ",";
+        }
+        REQUIRE(body.my_result == expected);
+
+        int sum = tbb::parallel_reduce(tbb::blocked_range<int>(0, n), 0,
+            [](const tbb::blocked_range<int>& r, int s) { return s + int(r.size()); },
+            std::plus<int>(), tbb::static_partitioner());
+        REQUIRE(sum == n);
+    }
+}
+
+} // namespace preallocated_task_tree_tests
+
+//! \brief \ref requirement
+TEST_CASE("static_partitioner with preallocated task trees") {
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, 64);
+    for (int num_threads : { 1, 4, 64 }) {
+        tbb::task_arena arena(num_threads);
+        arena.execute(preallocated_task_tree_tests::test_static_trees);
+    }
+}
+
+#if TBB_USE_EXCEPTIONS
+//! \brief \ref error_guessing
+TEST_CASE("static_partitioner with preallocated task trees propagates exceptions") {
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, 4);
+    tbb::task_arena arena(4);
+    arena.execute([] {
+        bool caught = false;
+        try {
+            tbb::parallel_reduce(tbb::blocked_range<int>(0, 1000), 0, [](const tbb::blocked_range<int>& r, int s) {
+                if (r.begin() <= 700 && 700 < r.end()) {
+                    throw std::runtime_error("static tree");
+                }
+                return s + int(r.size());
+            }, std::plus<int>(), tbb::static_partitioner());
+        } catch (const std::runtime_error& e) {
+            caught = std::string(e.what()) == "static tree";
+        }
+        REQUIRE(caught);
+    });
+}
+#endif // TBB_USE_EXCEPTIONS
+
+namespace tuning_partitioner_tests {
+
+//! Busy waits, so that the duration does not depend on the scheduling of the sleeping thread
+void spin_for(std::chrono::microseconds duration) {
+    auto end = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < end) {}
+}
+
+//! Runs a check that depends on the wall-clock time until it passes once
+/** A preempted thread distorts the measurements of the invocations it runs, for example
+    when the machine is loaded by other processes, so the check is given several attempts. */
+template <typename Check>
+bool passes_in_one_of(int attempts, Check check) {
+    for (int attempt = 0; attempt < attempts; ++attempt) {
+        if (check()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void test_correctness(int num_threads) {
+    tbb::task_arena arena(num_threads);
+    arena.execute([] {
+        tbb::tuning_partitioner partitioner;
+        const std::size_t n = 10000;
+        std::vector<std::atomic<int>> visits(n);
+        for (int invocation = 1; invocation <= 40; ++invocation) {
+            tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n), [&](const tbb::blocked_range<std::size_t>& r) {
+                for (std::size_t i = r.begin(); i != r.end(); ++i) {
+                    ++visits[i];
+                }
+            }, partitioner);
+            REQUIRE(partitioner.invocations() == std::size_t(2 * invocation - 1));
+            REQUIRE(partitioner.last_invocation().chunks > 0);
+
+            std::size_t sum = tbb::parallel_reduce(tbb::blocked_range<std::size_t>(0, n), std::size_t(0),
+                [](const tbb::blocked_range<std::size_t>& r, std::size_t s) { return s + r.size(); },
+                std::plus<std::size_t>(), partitioner);
+            REQUIRE(sum == n);
+            REQUIRE(partitioner.invocations() == std::size_t(2 * invocation));
+        }
+        tbb::parallel_for(std::size_t(0), n, [&](std::size_t i) { ++visits[i]; }, partitioner);
+        for (auto& v : visits) {
+            REQUIRE(v == 41);
+        }
+        REQUIRE(partitioner.depth() <= 2 * 5);
+
+        partitioner.reset();
+        REQUIRE(partitioner.invocations() == 0);
+    });
+}
+
+//! Every chunk has a fixed cost, so the coarsest splitting is the fastest
+void test_convergence() {
+    tbb::task_arena arena(1);
+    arena.execute([] {
+        tbb::tuning_partitioner partitioner;
+        std::size_t initial_depth = partitioner.depth();
+        bool converged = passes_in_one_of(5, [&] {
+            partitioner.reset();
+            for (int invocation = 0; invocation < 100; ++invocation) {
+                tbb::parallel_for(tbb::blocked_range<std::size_t>(0, 1024), [](const tbb::blocked_range<std::size_t>&) {
+                    spin_for(std::chrono::microseconds(20));
+                }, partitioner);
+            }
+            return partitioner.depth() < initial_depth;
+        });
+        INFO("learned depth " << partitioner.depth());
+        REQUIRE(converged);
+        auto stats = partitioner.last_invocation();
+        REQUIRE(stats.mean_chunk_time > 0);
+        REQUIRE(stats.elapsed_time >= stats.mean_chunk_time * double(stats.chunks));
+    });
+}
+
+} // namespace tuning_partitioner_tests
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("tuning_partitioner processes every iteration and counts invocations") {
+    tuning_partitioner_tests::test_correctness(1);
+    tbb::global_control concurrency(tbb::global_control::max_allowed_parallelism, 4);
+    tuning_partitioner_tests::test_correctness(4);
+}
+
+//! \brief \ref requirement
+TEST_CASE("tuning_partitioner learns the splitting depth") {
+    tuning_partitioner_tests::test_convergence();
+}
+
+namespace bandwidth_partitioner_tests {
+
+void test_correctness(int num_threads) {
+    tbb::task_arena arena(num_threads);
+    arena.execute([num_threads] {
+        tbb::bandwidth_partitioner partitioner;
+        const std::size_t n = 10000;
+        std::vector<std::atomic<int>> visits(n);
+        for (int invocation = 1; invocation <= 20; ++invocation) {
+            std::size_t limit = partitioner.concurrency();
+            std::atomic<std::size_t> chunks{0};
+            tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n), [&](const tbb::blocked_range<std::size_t>& r) {
+                ++chunks;
+                for (std::size_t i = r.begin(); i != r.end(); ++i) {
+                    ++visits[i];
+                }
+            }, partitioner);
+            auto stats = partitioner.last_invocation();
+            REQUIRE(partitioner.invocations() == std::size_t(2 * invocation - 1));
+            // Every allowed thread gets exactly one part
+            REQUIRE(chunks == stats.concurrency);
+            REQUIRE(stats.concurrency <= std::size_t(num_threads));
+            REQUIRE(limit >= 1);
+
+            std::size_t sum = tbb::parallel_reduce(tbb::blocked_range<std::size_t>(0, n), std::size_t(0),
+                [](const tbb::blocked_range<std::size_t>& r, std::size_t s) { return s + r.size(); },
+                std::plus<std::size_t>(), partitioner);
+            REQUIRE(sum == n);
+        }
+        tbb::parallel_for(std::size_t(0), n, [&](std::size_t i) { ++visits[i]; }, partitioner);
+        for (auto& v : visits) {
+            REQUIRE(v == 21);
+        }
+        REQUIRE(partitioner.concurrency() <= std::size_t(num_threads));
+
+        partitioner.reset();
+        REQUIRE(partitioner.invocations() == 0);
+    });
+}
+
+//! The work is serialized by a mutex, so additional threads do not help, as for a saturated memory bus
+void test_saturation() {
+    tbb::task_arena arena(8);
+    arena.execute([] {
+        tbb::bandwidth_partitioner partitioner;
+        oneapi::tbb::mutex bus;
+        bool saturated = tuning_partitioner_tests::passes_in_one_of(5, [&] {
+            partitioner.reset();
+            for (int invocation = 0; invocation < 100; ++invocation) {
+                tbb::parallel_for(tbb::blocked_range<std::size_t>(0, 1024), [&](const tbb::blocked_range<std::size_t>& r) {
+                    oneapi::tbb::mutex::scoped_lock lock(bus);
+                    tuning_partitioner_tests::spin_for(std::chrono::microseconds(2 * r.size()));
+                }, partitioner);
+            }
+            return partitioner.concurrency() <= 2;
+        });
+        INFO("learned concurrency " << partitioner.concurrency());
+        CHECK(saturated);
+    });
+}
+
+} // namespace bandwidth_partitioner_tests
+
+//! \brief \ref interface \ref requirement
+TEST_CASE("bandwidth_partitioner processes every iteration with the allowed number of parts") {
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, 8);
+    for (int num_threads : { 1, 3, 8 }) {
+        bandwidth_partitioner_tests::test_correctness(num_threads);
+    }
+}
+
+//! \brief \ref requirement
+TEST_CASE("bandwidth_partitioner does not add threads that do not help") {
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, 8);
+    bandwidth_partitioner_tests::test_saturation();
+}
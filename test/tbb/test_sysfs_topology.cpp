@@ -0,0 +1,220 @@
+/*
+    Copyright (c) 2025 Intel Corporation
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+//! \file test_sysfs_topology.cpp
+//! \brief Test for [internal] functionality
+
+#include "common/test.h"
+#include "common/utils.h"
+#include "common/utils_env.h"
+#include "src/tbb/sysfs_topology.h"
+
+#include "oneapi/tbb/info.h"
+#include "oneapi/tbb/task_arena.h"
+
+#if __TBB_SYSFS_TOPOLOGY_PRESENT
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using tbb::detail::r1::cpu_mask;
+using tbb::detail::r1::sysfs_topology;
+
+cpu_mask make_mask(const char* list) {
+    cpu_mask result;
+    REQUIRE(cpu_mask::parse_list(list, result));
+    return result;
+}
+
+//! Builds a fake sysfs tree in a temporary directory
+class fake_sysfs {
+    std::string my_root;
+    //! The directories and files in the order of creation
+    std::vector<std::string> my_dirs;
+    std::vector<std::string> my_files;
+
+    void make_dirs(const std::string& relative_path) {
+        std::size_t pos = 0;
+        while ((pos = relative_path.find('/', pos + 1)) != std::string::npos) {
+            std::string dir = my_root + "/" + relative_path.substr(0, pos);
+            if (mkdir(dir.c_str(), 0700) == 0) {
+                my_dirs.push_back(dir);
+            }
+        }
+    }
+public:
+    fake_sysfs() {
+        char name_template[] = "/tmp/tbb_sysfs_XXXXXX";
+        REQUIRE(mkdtemp(name_template) != nullptr);
+        my_root = name_template;
+    }
+    ~fake_sysfs() {
+        for (const std::string& file : my_files) {
+            CHECK(std::remove(file.c_str()) == 0);
+        }
+        // The nested directories are created after their parents
+        for (auto it = my_dirs.rbegin(); it != my_dirs.rend(); ++it) {
+            CHECK(rmdir(it->c_str()) == 0);
+        }
+        CHECK(rmdir(my_root.c_str()) == 0);
+    }
+    void write(const std::string& relative_path, const char* content) {
+        make_dirs(relative_path);
+        std::string path = my_root + "/" + relative_path;
+        std::FILE* file = std::fopen(path.c_str(), "w");
+        REQUIRE(file != nullptr);
+        if (std::find(my_files.begin(), my_files.end(), path) == my_files.end()) {
+            my_files.push_back(path);
+        }
+        std::fputs(content, file);
+        std::fclose(file);
+    }
+    const char* root() const { return my_root.c_str(); }
+};
+
+//! \brief \ref error_guessing
+TEST_CASE("cpulist parsing") {
+    cpu_mask mask;
+    REQUIRE(cpu_mask::parse_list("0-3,8,10-11\n", mask));
+    CHECK(mask.weight() == 7);
+    CHECK(mask.test(0));
+    CHECK(mask.test(3));
+    CHECK(!mask.test(4));
+    CHECK(mask.test(8));
+    CHECK(mask.test(11));
+
+    REQUIRE(cpu_mask::parse_list("\n", mask));
+    CHECK(mask.empty());
+
+    CHECK(!cpu_mask::parse_list("3-1", mask));
+    CHECK(!cpu_mask::parse_list("1;2", mask));
+    CHECK(!cpu_mask::parse_list("a", mask));
+}
+
+//! \brief \ref error_guessing
+TEST_CASE("cpu_mask operations") {
+    cpu_mask a = make_mask("0-3");
+    cpu_mask b = make_mask("2-5");
+    CHECK(a.intersects(b));
+    cpu_mask c = a;
+    c &= b;
+    CHECK(c == make_mask("2-3"));
+    c = a;
+    c |= b;
+    CHECK(c == make_mask("0-5"));
+    CHECK(!make_mask("0-1").intersects(make_mask("2-3")));
+}
+
+//! \brief \ref requirement
+TEST_CASE("NUMA nodes, core types and SMT parsing") {
+    fake_sysfs sysfs;
+    // Two NUMA nodes with two 2-way SMT cores each; node 1 is memory-only
+    sysfs.write("system/node/online", "0-2\n");
+    sysfs.write("system/node/node0/cpulist", "0-1,4-5\n");
+    sysfs.write("system/node/node1/cpulist", "\n");
+    sysfs.write("system/node/node2/cpulist", "2-3,6-7\n");
+    for (int cpu = 0; cpu < 8; ++cpu) {
+        std::string siblings = std::to_string(cpu % 4) + "," + std::to_string(cpu % 4 + 4) + "\n";
+        sysfs.write("system/cpu/cpu" + std::to_string(cpu) + "/topology/thread_siblings_list", siblings.c_str());
+    }
+    sysfs.write("cpu_core/cpus", "0-1,4-5\n");
+    sysfs.write("cpu_atom/cpus", "2-3,6-7\n");
+
+    sysfs_topology topology(sysfs.root());
+    REQUIRE(topology.parse(make_mask("0-7")));
+
+    // Memory-only node keeps its logical index but is not reported
+    REQUIRE(topology.numa_indexes().size() == 2);
+    CHECK(topology.numa_indexes()[0] == 0);
+    CHECK(topology.numa_indexes()[1] == 2);
+    CHECK(topology.constraints_mask(0, -1, -1) == make_mask("0-1,4-5"));
+    CHECK(topology.constraints_mask(2, -1, -1) == make_mask("2-3,6-7"));
+
+    // The less efficient core type goes first
+    REQUIRE(topology.core_type_indexes().size() == 2);
+    CHECK(topology.constraints_mask(-1, 0, -1) == make_mask("2-3,6-7"));
+    CHECK(topology.constraints_mask(-1, 1, -1) == make_mask("0-1,4-5"));
+
+    CHECK(topology.default_concurrency(-1, -1, -1) == 8);
+    CHECK(topology.default_concurrency(-1, -1, 1) == 4);
+    CHECK(topology.constraints_mask(0, -1, 1) == make_mask("0-1"));
+    CHECK(topology.default_concurrency(2, 0, 2) == 4);
+}
+
+//! \brief \ref requirement
+TEST_CASE("Topology is restricted by the process affinity mask") {
+    fake_sysfs sysfs;
+    sysfs.write("system/node/online", "0-1\n");
+    sysfs.write("system/node/node0/cpulist", "0-3\n");
+    sysfs.write("system/node/node1/cpulist", "4-7\n");
+
+    sysfs_topology topology(sysfs.root());
+    REQUIRE(topology.parse(make_mask("4-5")));
+
+    REQUIRE(topology.numa_indexes().size() == 1);
+    CHECK(topology.numa_indexes()[0] == 1);
+    // Without thread_siblings_list every CPU is a core of its own
+    CHECK(topology.default_concurrency(1, -1, 1) == 2);
+    // Without hybrid PMUs there is a single automatic core type
+    REQUIRE(topology.core_type_indexes().size() == 1);
+    CHECK(topology.core_type_indexes()[0] == -1);
+}
+
+//! \brief \ref error_guessing
+TEST_CASE("Missing sysfs falls back to a single NUMA node") {
+    sysfs_topology topology("/nonexistent_sysfs_root");
+    CHECK(!topology.parse(cpu_mask{}));
+    REQUIRE(topology.parse(make_mask("0-3")));
+    REQUIRE(topology.numa_indexes().size() == 1);
+    CHECK(topology.default_concurrency(0, -1, -1) == 4);
+}
+
+//! \brief \ref requirement
+TEST_CASE("Real sysfs topology is consistent with the process affinity") {
+    cpu_mask process_mask;
+    REQUIRE(cpu_mask::get_thread_affinity(process_mask));
+    sysfs_topology topology;
+    REQUIRE(topology.parse(process_mask));
+
+    cpu_mask all_nodes;
+    for (int numa_id : topology.numa_indexes()) {
+        cpu_mask node_mask = topology.constraints_mask(numa_id, -1, -1);
+        CHECK(!node_mask.empty());
+        CHECK(!all_nodes.intersects(node_mask));
+        all_nodes |= node_mask;
+    }
+    CHECK(all_nodes == process_mask);
+}
+
+//! \brief \ref requirement
+TEST_CASE("NUMA-constrained arena with TBB_ENABLE_SYSFS_TOPOLOGY") {
+    utils::SetEnv("TBB_ENABLE_SYSFS_TOPOLOGY", "1");
+    std::vector<tbb::numa_node_id> numa_nodes = tbb::info::numa_nodes();
+    REQUIRE(!numa_nodes.empty());
+    for (tbb::numa_node_id numa_id : numa_nodes) {
+        tbb::task_arena arena(tbb::task_arena::constraints{}.set_numa_id(numa_id));
+        CHECK(arena.max_concurrency() >= 1);
+        arena.execute([] {
+            CHECK(tbb::this_task_arena::current_thread_index() >= 0);
+        });
+    }
+}
+
+#endif /* __TBB_SYSFS_TOPOLOGY_PRESENT */
@@ -39,6 +39,7 @@
 #include <condition_variable>
 #include <cstdio>
 #include <cstdlib>
+#include <memory>
 #include <stdexcept>
 #include <thread>
 #include <vector>
@@ -2222,3 +2223,34 @@ TEST_CASE("Test enqueue guarantees when task_arena is combined with task_group")
 }
 
 #endif // TBB_USE_EXCEPTIONS
+
+//! \brief \ref error_guessing
+TEST_CASE("Large arenas with sparsely occupied slots") {
+    // Slots of large arenas are materialized on first occupation; mix a few threads
+    // with affinity hints and enqueued tasks to touch slots in an arbitrary order.
+    const int num_threads = 4;
+    const int num_slots = 512;
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, num_threads);
+    std::vector<std::unique_ptr<tbb::task_arena>> arenas;
+    for (int i = 0; i < 16; ++i) {
+        arenas.emplace_back(new tbb::task_arena(num_slots, i % 2));
+    }
+    tbb::affinity_partitioner ap;
+    for (int rep = 0; rep < 3; ++rep) {
+        for (auto& a : arenas) {
+            std::atomic<int> sum{0};
+            a->execute([&] {
+                tbb::parallel_for(0, 1000, [&](int i) { sum += i; }, ap);
+            });
+            CHECK(sum == 999 * 1000 / 2);
+
+            tbb::task_group tg;
+            std::atomic<int> executed{0};
+            for (int i = 0; i < 10; ++i) {
+                a->enqueue([&] { ++executed; }, tg);
+            }
+            a->wait_for(tg);
+            CHECK(executed == 10);
+        }
+    }
+}